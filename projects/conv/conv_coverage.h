@@ -0,0 +1,132 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef PROJECTS_CONV_CONV_COVERAGE_H
+#define PROJECTS_CONV_CONV_COVERAGE_H
+
+#include <array>
+#include <cstddef>
+
+#include "tb/coverage.h"
+
+namespace projects::conv {
+
+// Line buffer skid buffer state (ASIC line buffers only); there are N line
+// buffers for a kernel of diameter N (see conv_pkg::KERNEL_DIAMETER_N).
+template <std::size_t N>
+struct LbSkidState {
+  // Skid buffer holds valid data.
+  std::array<bool, N> vld;
+
+  // Index of the next pixel to be selected from the skid buffer.
+  std::array<std::size_t, N> idx;
+};
+
+// Functional coverage model for the conv stream (kernel diameter N).
+template <std::size_t N>
+class ConvCoverage {
+ public:
+  // Classification of an input beat.
+  enum class Beat : std::size_t {
+    Mid,
+    Sof,
+    Eol,
+  };
+  static constexpr std::size_t BEAT_N = 3;
+
+  // Classification of a kernel position along one axis (see
+  // conv_pkg::kernel_pos_t): bins [0, N / 2) correspond to leading
+  // positions (Lead(N / 2) .. Lead1), bin N / 2 to the interior, and bins
+  // (N / 2, N) to trailing positions (Trail1 .. Trail(N / 2)). For columns,
+  // leading/trailing correspond to W/E; for rows, to N/S.
+  static constexpr std::size_t BORDER_N = N;
+
+  // Skid buffers hold (lb_groups_per_word) pixel groups, where present.
+  explicit ConvCoverage(bool has_lb_skid, std::size_t lb_groups_per_word) {
+    backpressure_ =
+      model_.add_cross("sof_eol_backpressure", BEAT_N, /*backpressure*/ 2);
+    border_ = model_.add_cross("kernel_pos_border", BORDER_N, BORDER_N);
+    if (has_lb_skid) {
+      lb_skid_ =
+        model_.add_cross("lb_skid_occupancy", N, lb_groups_per_word);
+    }
+  }
+
+  tb::coverage::CoverageModel& model() noexcept { return model_; }
+  const tb::coverage::CoverageModel& model() const noexcept { return model_; }
+
+  // Sample input beat presented on the Slave interface (start of frame,
+  // end of line, or otherwise), against the backpressure applied on the
+  // Master interface in the same cycle. Presented rather than accepted
+  // beats are sampled, as the UUT reflects backpressure upstream (see
+  // conv_cntrl.sv); an accepted beat is never back-pressured.
+  void sample_in(bool tvalid, bool sof, bool eol, bool backpressure) noexcept {
+    if (!tvalid) {
+      return;
+    }
+    const Beat b = sof ? Beat::Sof : (eol ? Beat::Eol : Beat::Mid);
+    backpressure_->sample(static_cast<std::size_t>(b), backpressure ? 1 : 0);
+  }
+
+  // Sample position of kernel (y, x) emitted for a frame of (h, w).
+  void sample_kernel(
+    std::size_t y, std::size_t x, std::size_t h, std::size_t w) noexcept {
+    border_->sample(border(y, h), border(x, w));
+  }
+
+  // Sample line buffer skid buffer occupancy.
+  void sample_lb_skid(const LbSkidState<N>& s) noexcept {
+    if (!lb_skid_) {
+      return;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+      if (s.vld[i]) {
+        lb_skid_->sample(i, s.idx[i]);
+      }
+    }
+  }
+
+ private:
+  static std::size_t border(std::size_t i, std::size_t n) noexcept {
+    constexpr std::size_t R = N / 2;
+    if (i < R) {
+      return i;
+    } else if ((i + R) >= n) {
+      return (N - 1) - (n - 1 - i);
+    }
+    return R;
+  }
+
+  tb::coverage::CoverageModel model_;
+  tb::coverage::CrossPoint* backpressure_{nullptr};
+  tb::coverage::CrossPoint* border_{nullptr};
+  tb::coverage::CrossPoint* lb_skid_{nullptr};
+};
+
+}  // namespace projects::conv
+
+#endif  // PROJECTS_CONV_CONV_COVERAGE_H
@@ -42,9 +42,10 @@ module conv (
 // -------------------------------------------------------------------------- //
 
   input wire logic                           s_tvalid_i
-, input wire conv_pkg::pixel_t               s_tdata_i
+, input wire conv_pkg::pixel_group_t         s_tdata_i
 , input wire logic                           s_tlast_i
 , input wire logic                           s_tuser_i
+, input wire conv_pkg::channel_t             s_tid_i
 
 , output wire logic                          s_tready_o
 
@@ -57,9 +58,38 @@ module conv (
 , input wire logic                           m_tready_i
 //
 , output wire logic                          m_tvalid_o
-, output wire conv_pkg::kernel_t             m_tdata_o
+, output wire logic [cfg_pkg::M_TDATA_W - 1:0]
+                                             m_tdata_o
 , output wire logic                          m_tuser_o
 , output wire logic                          m_tlast_o
+, output wire conv_pkg::channel_t            m_tid_o
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Coefficient Load (OUTPUT_MODE == "FILTER")                                 //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, input wire logic                           coeff_vld_i
+, input wire logic [conv_pkg::COEFF_IDX_W - 1:0]
+                                             coeff_idx_i
+, input wire conv_pkg::coeff_t               coeff_dat_i
+, input wire logic [conv_pkg::MAC_SHIFT_W - 1:0]
+                                             coeff_shift_i
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Observation (testbench coverage)                                           //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+// Line buffer skid buffer state; ASIC line buffers only, otherwise zero.
+// Unconnected outside of the testbench.
+, output wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                                             tb_lb_skid_vld_o
+, output wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                    [conv_pkg::LB_ASIC_GROUPS_PER_WORD_N - 1:0]
+                                             tb_lb_skid_sel_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -80,23 +110,37 @@ module conv (
 // kerneling wires:
 //
 logic                                       kernel_colD_vld;
-logic [4:0]                                 kernel_colD_push;
-conv_pkg::kernel_pos_t                      kernel_colD_pos;
-conv_pkg::pixel_t [4:0]                     kernel_colD_data;
+logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]   kernel_colD_push;
+conv_pkg::kernel_pos_group_t                kernel_colD_pos;
+conv_pkg::channel_t                         kernel_colD_ch;
+conv_pkg::pixel_group_span_t                kernel_colD_data;
+
+// Kernel path is required by all but the separable filter.
+localparam bit KERNEL_EN = !(
+     (cfg_pkg::OUTPUT_MODE == "FILTER")
+  && (cfg_pkg::FILTER_IMPL == "SEPARABLE"));
 
 logic                                       kernel_vld;
-conv_pkg::kernel_t                          kernel_dat;
-conv_pkg::kernel_pos_t                      kernel_pos;
-conv_pkg::kernel_t                          kernel_dat_masked;
+conv_pkg::kernel_group_t                    kernel_dat;
+conv_pkg::kernel_pos_group_t                kernel_pos;
+conv_pkg::channel_t                         kernel_ch;
+conv_pkg::kernel_group_t                    kernel_dat_masked;
+
+// Egress (pre-output register):
+//
+logic                                       out_vld;
+logic [cfg_pkg::M_TDATA_W - 1:0]            out_dat;
+conv_pkg::channel_t                         out_ch;
 
 // Output registers:
 //
 `P_DFFR(logic, m_tvalid, 1'b0, clk, arst_n);
 
 logic                                       m_tdata_en;
-`P_DFFE(conv_pkg::kernel_t, m_tdata, m_tdata_en, clk);
+`P_DFFE(logic [cfg_pkg::M_TDATA_W - 1:0], m_tdata, m_tdata_en, clk);
 `P_DFFE(logic, m_tuser, m_tdata_en, clk);
 `P_DFFE(logic, m_tlast, m_tdata_en, clk);
+`P_DFFE(conv_pkg::channel_t, m_tid, m_tdata_en, clk);
 
 // ========================================================================= //
 //                                                                           //
@@ -104,6 +148,29 @@ logic                                       m_tdata_en;
 //                                                                           //
 // ========================================================================= //
 
+// ------------------------------------------------------------------------- //
+// Pixels per clock; the datapath is replicated per lane.
+
+`TB_STATIC_ASSERT(
+  (conv_pkg::PPC == 1) || (conv_pkg::PPC == 2) || (conv_pkg::PPC == 4),
+  "Unsupported PPC in conv.sv")
+
+`TB_STATIC_ASSERT(conv_pkg::PPC <= conv_pkg::PPC_MAX,
+  "PPC exceeds PPC_MAX in conv.sv")
+
+// Kernel diameter.
+
+`TB_STATIC_ASSERT(
+     (conv_pkg::KERNEL_DIAMETER_N == 3)
+  || (conv_pkg::KERNEL_DIAMETER_N == 5)
+  || (conv_pkg::KERNEL_DIAMETER_N == 7),
+  "Unsupported KERNEL_DIAMETER_N in conv.sv")
+
+// Interleaved channels.
+
+`TB_STATIC_ASSERT(conv_pkg::CHANNEL_N >= 1,
+  "Unsupported CHANNEL_N in conv.sv")
+
 // ------------------------------------------------------------------------- //
 //
 
@@ -113,6 +180,7 @@ conv_cntrl u_conv_cntrl (
 , .s_tdata_i               (s_tdata_i)
 , .s_tuser_i               (s_tuser_i)
 , .s_tlast_i               (s_tlast_i)
+, .s_tid_i                 (s_tid_i)
 , .s_tready_o              (s_tready_o)
 //
 , .m_tready_i              (m_tready_i)
@@ -120,15 +188,21 @@ conv_cntrl u_conv_cntrl (
 , .kernel_colD_vld_o       (kernel_colD_vld)
 , .kernel_colD_push_o      (kernel_colD_push)
 , .kernel_colD_pos_o       (kernel_colD_pos)
+, .kernel_colD_ch_o        (kernel_colD_ch)
 , .kernel_colD_data_o      (kernel_colD_data)
 //
+, .tb_lb_skid_vld_o        (tb_lb_skid_vld_o)
+, .tb_lb_skid_sel_o        (tb_lb_skid_sel_o)
+//
 , .clk                     (clk)
 , .arst_n                  (arst_n)
 );
 
 // ------------------------------------------------------------------------- //
-//
+// Kernel path; elided when filtering by the separable implementation, which
+// operates directly upon the line-buffer column.
 
+if (KERNEL_EN) begin: kernel_path_GEN
 
 conv_kernel u_conv_kernel (
 //
@@ -136,10 +210,12 @@ conv_kernel u_conv_kernel (
 , .colD_push_i               (kernel_colD_push)
 , .colD_dat_i                (kernel_colD_data)
 , .colD_pos_i                (kernel_colD_pos)
+, .colD_ch_i                 (kernel_colD_ch)
 //
 , .kernel_vld_o              (kernel_vld)
 , .kernel_dat_o              (kernel_dat)
 , .kernel_pos_o              (kernel_pos)
+, .kernel_ch_o               (kernel_ch)
 //
 , .clk                       (clk)
 , .arst_n                    (arst_n)
@@ -147,18 +223,22 @@ conv_kernel u_conv_kernel (
 
 // ------------------------------------------------------------------------- //
 // Combinational mask logic to zero out pixels that are outside the image
-// boundaries according to the nominated extension strategy.
+// boundaries according to the nominated extension strategy (per lane).
 
-generate case (cfg_pkg::EXTEND_STRATEGY)
+case (cfg_pkg::EXTEND_STRATEGY)
 
 "ZERO_PAD": begin: zero_pad_GEN
 
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: lane_GEN
+
 conv_mask_zp u_conv_mask_zp (
-    .kernel_i           (kernel_dat)
-  , .kernel_pos_i       (kernel_pos)
-  , .kernel_masked_o    (kernel_dat_masked)
+    .kernel_i           (kernel_dat[p])
+  , .kernel_pos_i       (kernel_pos[p])
+  , .kernel_masked_o    (kernel_dat_masked[p])
 );
 
+end: lane_GEN
+
 end: zero_pad_GEN
 
 "REPLICATE": begin : replicate_GEN
@@ -174,18 +254,132 @@ default: begin: default_GEN
 end : default_GEN
 
 endcase
-endgenerate
 
+end: kernel_path_GEN
+else begin: kernel_path_bypass_GEN
+
+assign kernel_vld = 1'b0;
+assign kernel_dat = '0;
+assign kernel_pos = '0;
+assign kernel_ch = '0;
+assign kernel_dat_masked = '0;
+
+logic UNUSED_kernel_colD_push;
+assign UNUSED_kernel_colD_push = ^kernel_colD_push;
+
+end: kernel_path_bypass_GEN
 
 // ------------------------------------------------------------------------- //
+// Output mode selection.
+
+generate case (cfg_pkg::OUTPUT_MODE)
+
+"KERNEL": begin: kernel_GEN
+
+assign out_vld = kernel_vld;
+assign out_dat = kernel_dat_masked;
+assign out_ch = kernel_ch;
+
+// Coefficient load interface is unused.
+logic UNUSED_coeff;
+assign UNUSED_coeff = ^{coeff_vld_i, coeff_idx_i, coeff_dat_i, coeff_shift_i};
+
+end: kernel_GEN
+
+"FILTER": begin: filter_GEN
+
+logic filter_vld;
+
+// Filter pipeline is stalled by egress back-pressure only; upstream
+// starvation is absorbed as a pipeline bubble.
+case (cfg_pkg::FILTER_IMPL)
+
+"FULL": begin: full_GEN
+
+conv_mac u_conv_mac (
+//
+  .vld_i                     (kernel_vld)
+, .kernel_i                  (kernel_dat_masked)
+, .ch_i                      (kernel_ch)
+, .stall_i                   (~m_tready_i)
+//
+, .coeff_vld_i               (coeff_vld_i)
+, .coeff_idx_i               (coeff_idx_i)
+, .coeff_dat_i               (coeff_dat_i)
+, .shift_i                   (coeff_shift_i)
 //
-assign m_tvalid_w = kernel_vld | (m_tvalid_r & (~m_tready_i));
-assign m_tdata_en = kernel_vld;
-assign m_tdata_w = kernel_dat_masked;
+, .vld_o                     (filter_vld)
+, .dat_o                     (out_dat)
+, .ch_o                      (out_ch)
+//
+, .clk                       (clk)
+, .arst_n                    (arst_n)
+);
+
+end: full_GEN
+
+"SEPARABLE": begin: separable_GEN
+
+`TB_STATIC_ASSERT(cfg_pkg::EXTEND_STRATEGY == "ZERO_PAD",
+  "Separable filter supports ZERO_PAD extension only in conv.sv")
+
+conv_sep u_conv_sep (
+//
+  .colD_vld_i                (kernel_colD_vld)
+, .colD_dat_i                (kernel_colD_data)
+, .colD_pos_i                (kernel_colD_pos)
+, .colD_ch_i                 (kernel_colD_ch)
+, .stall_i                   (~m_tready_i)
+//
+, .coeff_vld_i               (coeff_vld_i)
+, .coeff_idx_i               (coeff_idx_i)
+, .coeff_dat_i               (coeff_dat_i)
+, .shift_i                   (coeff_shift_i)
+//
+, .vld_o                     (filter_vld)
+, .dat_o                     (out_dat)
+, .ch_o                      (out_ch)
+//
+, .clk                       (clk)
+, .arst_n                    (arst_n)
+);
+
+end: separable_GEN
+
+default: begin: filter_impl_default_GEN
+
+`TB_ERROR("Unsupported filter implementation in conv.sv");
+
+end: filter_impl_default_GEN
+
+endcase
+
+assign out_vld = filter_vld & m_tready_i;
+
+end: filter_GEN
+
+default: begin: output_mode_default_GEN
+
+`TB_ERROR("Unsupported output mode in conv.sv");
+
+end: output_mode_default_GEN
+
+endcase
+endgenerate
+
+// ------------------------------------------------------------------------- //
+//
+assign m_tvalid_w = out_vld | (m_tvalid_r & (~m_tready_i));
+assign m_tdata_en = out_vld;
+assign m_tdata_w = out_dat;
 
 assign m_tuser_w = 1'b0;
 assign m_tlast_w = 1'b0;
 
+// Channel ID is carried through the pipeline alongside the pixel position,
+// originating from the ingress TID.
+assign m_tid_w = out_ch;
+
 // ========================================================================= //
 //                                                                           //
 // Outputs                                                                   //
@@ -196,6 +390,7 @@ assign m_tvalid_o = m_tvalid_r;
 assign m_tdata_o = m_tdata_r;
 assign m_tuser_o = m_tuser_r;
 assign m_tlast_o = m_tlast_r;
+assign m_tid_o = m_tid_r;
 
 endmodule : conv
 
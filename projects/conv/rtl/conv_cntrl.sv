@@ -41,18 +41,34 @@ module conv_cntrl (
 // -------------------------------------------------------------------------- //
 
   input wire logic                          s_tvalid_i
-, input wire conv_pkg::pixel_t              s_tdata_i
+, input wire conv_pkg::pixel_group_t        s_tdata_i
 , input wire logic                          s_tuser_i
 , input wire logic                          s_tlast_i
+, input wire conv_pkg::channel_t            s_tid_i
 
 , output wire logic                         s_tready_o
 
 , input wire logic                          m_tready_i
 
 , output wire logic                         kernel_colD_vld_o
-, output wire logic [4:0]                   kernel_colD_push_o
-, output conv_pkg::kernel_pos_t             kernel_colD_pos_o
-, output conv_pkg::pixel_t [4:0]            kernel_colD_data_o
+, output wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                                            kernel_colD_push_o
+, output conv_pkg::kernel_pos_group_t       kernel_colD_pos_o
+, output conv_pkg::channel_t                kernel_colD_ch_o
+, output conv_pkg::pixel_group_span_t       kernel_colD_data_o
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Observation (testbench coverage)                                           //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+// Line buffer skid buffer state; ASIC line buffers only, otherwise zero.
+, output wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                                            tb_lb_skid_vld_o
+, output wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                    [conv_pkg::LB_ASIC_GROUPS_PER_WORD_N - 1:0]
+                                            tb_lb_skid_sel_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -71,61 +87,84 @@ module conv_cntrl (
 // ========================================================================= //
 
 typedef struct packed {
+  conv_pkg::channel_t   ch;
   logic                 sof;
   logic                 eol;
 } col_pos_t;
 
 localparam int COL_POS_W = $bits(col_pos_t);
 
-// Interface Delay Pipeline
+localparam int R = conv_pkg::KERNEL_RADIUS_N;
+localparam int D = conv_pkg::KERNEL_DIAMETER_N;
+localparam int C = conv_pkg::CHANNEL_N;
+
+// Interface delay pipeline; Pixel 0 (the determination stage) is at stage
+// R, preceded by the R pixels to its east and followed by the R pixels to
+// its west. Stages are of a single channel; as channels are interleaved,
+// stage i is held at beat (i * C) of the pipeline.
+localparam int PIXEL_PIPE_N = 2 * R;
+localparam int PIXEL_PIPE_BEATS_N = PIXEL_PIPE_N * C;
+
 logic                        pixel_pipe_0_vld;
 col_pos_t                    pixel_pipe_0_pos;
-conv_pkg::pixel_t            pixel_pipe_0_dat;
+conv_pkg::pixel_group_t      pixel_pipe_0_dat;
+conv_pkg::channel_t          pixel_pipe_0_ch_exp;
+
+logic [PIXEL_PIPE_BEATS_N:1] pixel_pipe_vld_r;
+col_pos_t [PIXEL_PIPE_BEATS_N:1]
+                             pixel_pipe_r;
+conv_pkg::pixel_group_t      pixel_pipe_N_dat_r;
 
-logic [4:1]                  pixel_pipe_vld_r;
-col_pos_t [4:1]              pixel_pipe_r;
-conv_pkg::pixel_t            pixel_pipe_N_dat_r;
+// Pipeline, including ingress (beat 0).
+logic [PIXEL_PIPE_BEATS_N:0] pixel_pipe_vld;
+col_pos_t [PIXEL_PIPE_BEATS_N:0]
+                             pixel_pipe;
+
+// Pixel (group) at stage i is the first (sol) or last (eol) of its line.
+logic [PIXEL_PIPE_N - 1:0]   pixel_pipe_sol;
+logic [PIXEL_PIPE_N:0]       pixel_pipe_eol;
 
 logic                        pixel0_vld_r;
-conv_pkg::kernel_pos_t       pixel0_pos_r;
-conv_pkg::pixel_t            pixel0_data_r;
+conv_pkg::channel_t          pixel0_ch_r;
+conv_pkg::kernel_pos_group_t pixel0_pos_r;
+conv_pkg::pixel_group_t      pixel0_data_r;
 
-logic                        pos_w2;
-logic                        pos_w1;
-logic                        pos_e2;
-logic                        pos_e1;
+conv_pkg::kernel_pos_dir_t [conv_pkg::PPC - 1:0]  pos_w;
+conv_pkg::kernel_pos_dir_t [conv_pkg::PPC - 1:0]  pos_e;
 
-logic                        pos_n2;
-logic                        pos_n1;
-logic                        pos_s2;
-logic                        pos_s1;
+conv_pkg::kernel_pos_dir_t   pos_n;
+conv_pkg::kernel_pos_dir_t   pos_s;
 
 logic                        cntrl_stall;
 
 logic                        bank_push_sel_en;
-logic [4:0]                  bank_push_sel_r;
-logic [4:0]                  bank_push_sel_w;
+logic [D - 1:0]              bank_push_sel_r;
+logic [D - 1:0]              bank_push_sel_w;
 
 logic                        row_pos_en;
-logic [3:0]                  row_pos_r;
-logic [3:0]                  row_pos_w;
-logic [4:0]                  row_vld_r;
-logic [4:0]                  row_vld_w;
+logic [D - 2:0]              row_pos_r;
+logic [D - 2:0]              row_pos_w;
+logic [D - 1:0]              row_vld_r;
+logic [D - 1:0]              row_vld_w;
 
 // Line Buffer Control
-logic [4:0]                  lb_push;
-logic [4:0]                  lb_pop;
-conv_pkg::pixel_t            lb_dat;
+logic [D - 1:0]              lb_push;
+logic [D - 1:0]              lb_pop;
+conv_pkg::pixel_group_t      lb_dat;
 logic                        lb_sol;
 logic                        lb_eol;
-conv_pkg::pixel_t [4:0]      lb_colD;
+conv_pkg::pixel_group_span_t lb_colD;
+logic [D - 1:0]              lb_skid_vld;
+logic [D - 1:0][conv_pkg::LB_ASIC_GROUPS_PER_WORD_N - 1:0]
+                             lb_skid_sel;
 
 typedef struct packed {
-  logic [4:0]                pop;
-  logic [4:0]                push;
-  conv_pkg::pixel_t          dat;
-  conv_pkg::kernel_pos_t     pos;
-  logic [4:0]                row_vld;
+  logic [D - 1:0]              pop;
+  logic [D - 1:0]              push;
+  conv_pkg::pixel_group_t      dat;
+  conv_pkg::kernel_pos_group_t pos;
+  conv_pkg::channel_t          ch;
+  logic [D - 1:0]              row_vld;
 } egress_pipe_t;
 localparam int EGRESS_PIPE_W = $bits(egress_pipe_t);
 
@@ -137,9 +176,10 @@ egress_pipe_t                egress_pipe_out_r;
 
 logic                        kernel_colD_vld_pre;
 logic                        kernel_colD_vld;
-logic [4:0]                  kernel_colD_push;
-conv_pkg::kernel_pos_t       kernel_colD_pos;
-conv_pkg::pixel_t [4:0]      kernel_colD_data;
+logic [D - 1:0]              kernel_colD_push;
+conv_pkg::kernel_pos_group_t kernel_colD_pos;
+conv_pkg::channel_t          kernel_colD_ch;
+conv_pkg::pixel_group_span_t kernel_colD_data;
 
 // ========================================================================= //
 //                                                                           //
@@ -167,10 +207,21 @@ assign s_tready_o = m_tready_i;
 // Pixel position and data delay pipeline.
 
 assign pixel_pipe_0_vld = s_tvalid_i;
-assign pixel_pipe_0_pos = '{ sof: s_tuser_i, eol: s_tlast_i }; 
+assign pixel_pipe_0_pos =
+  '{ ch: (C > 1) ? s_tid_i : '0, sof: s_tuser_i, eol: s_tlast_i };
 assign pixel_pipe_0_dat = s_tdata_i;
 
-dp #(.W(COL_POS_W), .N(4)) u_dp_col (
+// Channels are presented in strict rotation.
+assign pixel_pipe_0_ch_exp =
+    (pixel_pipe_r[1].ch == conv_pkg::channel_t'(C - 1))
+  ? '0
+  : (pixel_pipe_r[1].ch + 'b1);
+
+`P_ASSERT_CR(clk, arst_n,
+  (~pixel_pipe_0_vld | ~pixel_pipe_vld_r[1])
+  | (pixel_pipe_0_pos.ch == pixel_pipe_0_ch_exp));
+
+dp #(.W(COL_POS_W), .N(PIXEL_PIPE_BEATS_N)) u_dp_col (
   .vld_i                   (pixel_pipe_0_vld)
 , .dat_i                   (pixel_pipe_0_pos)
 , .stall_i                 (cntrl_stall)
@@ -184,7 +235,7 @@ dp #(.W(COL_POS_W), .N(4)) u_dp_col (
 
 // Pixel delay pipeline to align with Pixel 0 position.
 //
-dp #(.W(conv_pkg::PIXEL_W), .N(2)) u_dp_pixel (
+dp #(.W(conv_pkg::PIXEL_GROUP_W), .N(R * C)) u_dp_pixel (
   .vld_i                   (pixel_pipe_0_vld)
 , .dat_i                   (pixel_pipe_0_dat)
 , .stall_i                 (cntrl_stall)
@@ -196,8 +247,29 @@ dp #(.W(conv_pkg::PIXEL_W), .N(2)) u_dp_pixel (
 , .arst_n                  (arst_n)
 );
 
+assign pixel_pipe_vld = {pixel_pipe_vld_r, pixel_pipe_0_vld};
+assign pixel_pipe = {pixel_pipe_r, pixel_pipe_0_pos};
+
+for (genvar i = 0; i <= PIXEL_PIPE_N; i++) begin: pixel_pipe_pos_GEN
+
+if (i < PIXEL_PIPE_N) begin: sol_GEN
+assign pixel_pipe_sol[i] =
+    (pixel_pipe_vld[i * C] & pixel_pipe[i * C].sof)
+  | (pixel_pipe_vld[(i + 1) * C] & pixel_pipe[(i + 1) * C].eol);
+end: sol_GEN
+
+assign pixel_pipe_eol[i] = pixel_pipe[i * C].eol;
+
+end: pixel_pipe_pos_GEN
+
+// Intervening beats of the pipeline hold pixels of other channels.
+if (C > 1) begin: channel_GEN
+logic UNUSED_pixel_pipe;
+assign UNUSED_pixel_pipe = ^{pixel_pipe_vld, pixel_pipe};
+end: channel_GEN
+
 // ------------------------------------------------------------------------- //
-// Column position determination.
+// Column position determination (shown for KERNEL_DIAMETER_N == 5).
 //
 //  0: Ingress
 //
@@ -218,20 +290,38 @@ dp #(.W(conv_pkg::PIXEL_W), .N(2)) u_dp_pixel (
 //  4: Pixel -2
 //
 // (Qualified on line validity)
+//
+// Generally, Pixel 0 is at stage R (KERNEL_RADIUS_N), and Wk (Ek) iff the
+// pixel (R - k) to the west (east) is the first (last) of its line.
+//
+// For PPC > 1, each stage holds a group of pixels and positions are
+// determined per lane of the Pixel 0 group. As the image width is a
+// multiple of PPC, a line always starts on lane 0 and ends on lane PPC - 1.
+// The pixel (R - k) to the west of lane p is therefore the first of its
+// line iff p == (R - k) % PPC and the group (R - k) / PPC to the west of
+// the Pixel 0 group is the first of its line; similarly for the east.
+// (For R <= PPC, all determinations are made from stages R and R + 1.)
+
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: pos_col_p_GEN
+
+for (genvar k = 1; k <= R; k++) begin: pos_col_k_GEN
+
+assign pos_w[p][k] =
+    (p == ((R - k) % conv_pkg::PPC))
+  ? pixel_pipe_sol[R + ((R - k) / conv_pkg::PPC)]
+  : 1'b0;
 
-assign pos_w2 =
-    pixel_pipe_r[2].sof
-  | (pixel_pipe_vld_r[3] & pixel_pipe_r[3].eol);
+assign pos_e[p][k] =
+    (p == (conv_pkg::PPC - 1 - ((R - k) % conv_pkg::PPC)))
+  ? pixel_pipe_eol[R - ((R - k) / conv_pkg::PPC)]
+  : 1'b0;
 
-assign pos_w1 = 
-    (pixel_pipe_vld_r[3] & pixel_pipe_r[3].sof)
-  | (pixel_pipe_vld_r[4] & pixel_pipe_r[4].eol);
+end: pos_col_k_GEN
 
-assign pos_e1 = pixel_pipe_r[1].eol;
-assign pos_e2 = pixel_pipe_r[2].eol;
+end: pos_col_p_GEN
 
 // ------------------------------------------------------------------------- //
-// Row position determination.
+// Row position determination (shown for KERNEL_DIAMETER_N == 5).
 //
 //  0: Line -2
 //
@@ -251,39 +341,52 @@ assign pos_e2 = pixel_pipe_r[2].eol;
 //
 //  4: Line +2
 //
-assign pos_n2 = row_vld_r[2] & row_pos_r[2];
-assign pos_n1 = row_vld_r[2] & row_pos_r[3] & row_vld_r[3];
-assign pos_s1 = row_vld_r[2] & row_pos_r[0] & row_vld_r[0];
-assign pos_s2 = row_vld_r[2] & row_pos_r[1] & row_vld_r[1];
+// Generally, Line 0 is at stage R, and Nk iff the line (R - k) to the north
+// is the first of the frame (stage 2R - k); Sk iff the line (R - k + 1) to
+// the south is the first of the next frame (stage k - 1).
+//
+for (genvar k = 1; k <= R; k++) begin: pos_row_GEN
+
+assign pos_n[k] = row_vld_r[R] & row_pos_r[2 * R - k] & row_vld_r[2 * R - k];
+assign pos_s[k] = row_vld_r[R] & row_pos_r[k - 1] & row_vld_r[k - 1];
+
+end: pos_row_GEN
 
 // ------------------------------------------------------------------------- //
 //
 
-localparam logic [3:0] ROW_POS_INIT = 4'b0000;
-dffre #(.W(4), .INIT(ROW_POS_INIT)) u_dffr_row_pos (
+localparam logic [D - 2:0] ROW_POS_INIT = '0;
+dffre #(.W(D - 1), .INIT(ROW_POS_INIT)) u_dffr_row_pos (
   .d(row_pos_w), .q(row_pos_r), .en(row_pos_en), .arst_n(arst_n), .clk(clk));
 
-localparam logic [4:0] ROW_VLD_INIT = 5'b00000;
-dffre #(.W(5), .INIT(ROW_VLD_INIT)) u_dffr_row_vld (
+localparam logic [D - 1:0] ROW_VLD_INIT = '0;
+dffre #(.W(D), .INIT(ROW_VLD_INIT)) u_dffr_row_vld (
   .d(row_vld_w), .q(row_vld_r), .en(row_pos_en), .arst_n(arst_n), .clk(clk));
 
+// Row advances as the first pixel of a line enters the determination stage.
+// Rows are common to all channels and advance on channel 0; the preceding
+// beat is then the last of the line of channel (C - 1).
 assign row_pos_en = 
-    pixel_pipe_vld_r[1]
+    pixel_pipe_vld[R * C - 1]
   & (~cntrl_stall)
-  & (pixel_pipe_r[2].eol | pixel_pipe_r[1].sof);
+  & (pixel_pipe[R * C - 1].ch == '0)
+  & (pixel_pipe[R * C].eol | pixel_pipe[R * C - 1].sof);
 
-assign row_pos_w = {row_pos_r[2:0], pixel_pipe_r[1].sof};
-assign row_vld_w = {row_vld_r[3:0], 1'b1};
+assign row_pos_w = {row_pos_r[D - 3:0], pixel_pipe[R * C - 1].sof};
+assign row_vld_w = {row_vld_r[D - 2:0], 1'b1};
 
 // ------------------------------------------------------------------------- //
 // Pixel 0 registers.
 
-assign pixel0_vld_r = pixel_pipe_vld_r[2];
+assign pixel0_vld_r = pixel_pipe_vld_r[R * C];
+assign pixel0_ch_r = pixel_pipe_r[R * C].ch;
+
+// Row position is common to all lanes of the group.
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: pixel0_pos_GEN
 
-assign pixel0_pos_r = '{
-  w2: pos_w2, w1: pos_w1, e1: pos_e1, e2: pos_e2,
-  n2: pos_n2, n1: pos_n1, s1: pos_s1, s2: pos_s2
-};
+assign pixel0_pos_r[p] = '{w: pos_w[p], e: pos_e[p], n: pos_n, s: pos_s};
+
+end: pixel0_pos_GEN
 
 assign pixel0_data_r = pixel_pipe_N_dat_r;
 
@@ -292,21 +395,26 @@ assign pixel0_data_r = pixel_pipe_N_dat_r;
 //
 // Circular allocation line-buffer updated on row advance.
 
-localparam logic [4:0] BANK_PUSH_SEL_INIT = 5'b00000;
-dffre #(.W(5), .INIT(BANK_PUSH_SEL_INIT)) u_dffr_bank_push_sel (
+localparam logic [D - 1:0] BANK_PUSH_SEL_INIT = '0;
+dffre #(.W(D), .INIT(BANK_PUSH_SEL_INIT)) u_dffr_bank_push_sel (
   .d(bank_push_sel_w), .q(bank_push_sel_r),
   .en(bank_push_sel_en), .arst_n(arst_n), .clk(clk));
 
 assign bank_push_sel_en = row_pos_en;
 assign bank_push_sel_w = 
     (row_vld_r == 'b0)
-  ? 5'b00001
-  : {bank_push_sel_r[3:0], bank_push_sel_r[4]};
+  ? D'(1)
+  : {bank_push_sel_r[D - 2:0], bank_push_sel_r[D - 1]};
 
-assign lb_push = pixel0_vld_r & (~cntrl_stall) ? bank_push_sel_r : 5'b00000;
+assign lb_push = pixel0_vld_r & (~cntrl_stall) ? bank_push_sel_r : '0;
 assign lb_dat = pixel0_data_r;
-assign lb_sol = pixel0_pos_r.w2;
-assign lb_eol = pixel0_pos_r.e2;
+
+// Line buffers retain the lines of all channels, interleaved; the buffer
+// line begins on channel 0 and ends on channel (C - 1).
+assign lb_sol = pixel0_pos_r[0].w[R] & (pixel0_ch_r == '0);
+assign lb_eol =
+    pixel0_pos_r[conv_pkg::PPC - 1].e[R]
+  & (pixel0_ch_r == conv_pkg::channel_t'(C - 1));
 
 // Push upto one back per cycle.
 `P_ASSERT_CR(clk, arst_n, $onehot0(lb_push));
@@ -314,7 +422,7 @@ assign lb_eol = pixel0_pos_r.e2;
 // ------------------------------------------------------------------------- //
 // Line Buffer Pop Control.
 
-assign lb_pop = (lb_push != '0) ? (row_vld_r & ~bank_push_sel_r) : 5'b00000;
+assign lb_pop = (lb_push != '0) ? (row_vld_r & ~bank_push_sel_r) : '0;
 
 // May not pop from a bank that is not being pushed to.
 `P_ASSERT_CR(clk, arst_n, (lb_push & lb_pop) == 'b0);
@@ -326,7 +434,7 @@ generate case (cfg_pkg::TARGET)
 
 "FPGA": begin: conv_lb_fpga_GEN
 
-for (genvar i = 0; i < 5; i++) begin: lb_GEN
+for (genvar i = 0; i < D; i++) begin: lb_GEN
 
 conv_cntrl_lb_fpga u_conv_cntrl_lb_fpga (
 //
@@ -344,11 +452,15 @@ conv_cntrl_lb_fpga u_conv_cntrl_lb_fpga (
 
 end : lb_GEN
 
+// No skid buffers.
+assign lb_skid_vld = '0;
+assign lb_skid_sel = '0;
+
 end: conv_lb_fpga_GEN
 
 "ASIC": begin: conv_cntrl_lb_asic_GEN
 
-for (genvar i = 0; i < 5; i++) begin: lb_GEN
+for (genvar i = 0; i < D; i++) begin: lb_GEN
 
 conv_cntrl_lb_asic u_conv_cntrl_lb_asic (
 //
@@ -360,6 +472,9 @@ conv_cntrl_lb_asic u_conv_cntrl_lb_asic (
 //
 , .colD_o                 (lb_colD[i])
 //
+, .tb_skid_vld_o          (lb_skid_vld[i])
+, .tb_skid_sel_o          (lb_skid_sel[i])
+//
 , .clk                    (clk)
 , .arst_n                 (arst_n)
 );
@@ -383,7 +498,7 @@ endgenerate
 assign egress_pipe_in_vld = (lb_push != 'b0);
 assign egress_pipe_in =
   '{ pop: lb_pop, push: lb_push, dat: pixel0_data_r, pos: pixel0_pos_r,
-     row_vld: row_vld_r };
+     ch: pixel0_ch_r, row_vld: row_vld_r };
 
 dp #(
   .W                       (EGRESS_PIPE_W)
@@ -404,46 +519,36 @@ dp #(
 // ------------------------------------------------------------------------- //
 // Line buffer rotator.
 
-// Rotate line-buffer outputs based on image position.
+// Rotate line-buffer outputs based on image position. When pushing to bank
+// b, row m (m > 0) of the column is held by bank (b - m) mod D; row 0 is
+// the pixel in flight. For example, (KERNEL_DIAMETER_N == 5):
+//
+//   push == 5'b00001: {lb[1], lb[2], lb[3], lb[4], dat}
+//
+//   push == 5'b00010: {lb[2], lb[3], lb[4], lb[0], dat}
+//
 always_comb begin: kernel_colD_rotator_PROC
 
-  case (egress_pipe_out_r.push) inside
-    5'b00001: kernel_colD_data = {
-        lb_colD[1], lb_colD[2], lb_colD[3], lb_colD[4], egress_pipe_out_r.dat
-      };
-
-    5'b00010: kernel_colD_data = {
-        lb_colD[2], lb_colD[3], lb_colD[4], lb_colD[0], egress_pipe_out_r.dat
-      };
-
-    5'b00100: kernel_colD_data = {
-        lb_colD[3], lb_colD[4], lb_colD[0], lb_colD[1], egress_pipe_out_r.dat
-      };
-    
-    5'b01000: kernel_colD_data = {
-        lb_colD[4], lb_colD[0], lb_colD[1], lb_colD[2], egress_pipe_out_r.dat
-      };
-    
-    5'b10000: kernel_colD_data = {
-        lb_colD[0], lb_colD[1], lb_colD[2], lb_colD[3], egress_pipe_out_r.dat
-      };
-
-    default: kernel_colD_data = 'x;
-  endcase
+  kernel_colD_data = 'x;
+  for (int b = 0; b < D; b++) begin
+    if (egress_pipe_out_r.push[b]) begin
+      kernel_colD_data[0] = egress_pipe_out_r.dat;
+      for (int m = 1; m < D; m++)
+        kernel_colD_data[m] = lb_colD[(b + D - m) % D];
+    end
+  end
 
 end : kernel_colD_rotator_PROC
 
-// Pixel validity determination. Kernel is valid when the center pixel is valid.
+// Pixel validity determination. Kernel is valid when the center pixel is
+// valid; the center line (R lines prior) is held by bank (b - R) mod D.
 always_comb begin: kernel_colD_vld_PROC
 
-  case (egress_pipe_out_r.push) inside
-    5'b00001: kernel_colD_vld_pre = egress_pipe_out_r.row_vld[3];
-    5'b00010: kernel_colD_vld_pre = egress_pipe_out_r.row_vld[4];
-    5'b00100: kernel_colD_vld_pre = egress_pipe_out_r.row_vld[0];
-    5'b01000: kernel_colD_vld_pre = egress_pipe_out_r.row_vld[1];
-    5'b10000: kernel_colD_vld_pre = egress_pipe_out_r.row_vld[2];
-    default:  kernel_colD_vld_pre = 1'bx;
-  endcase
+  kernel_colD_vld_pre = 1'bx;
+  for (int b = 0; b < D; b++) begin
+    if (egress_pipe_out_r.push[b])
+      kernel_colD_vld_pre = egress_pipe_out_r.row_vld[(b + D - R) % D];
+  end
 
 end: kernel_colD_vld_PROC
 
@@ -453,6 +558,7 @@ assign kernel_colD_vld =
   kernel_colD_vld_pre & egress_pipe_out_vld_r & (~cntrl_stall);
 
 assign kernel_colD_pos = egress_pipe_out_r.pos;
+assign kernel_colD_ch = egress_pipe_out_r.ch;
 
 // Kernel column D outputs.
 assign kernel_colD_push = 
@@ -469,8 +575,12 @@ assign kernel_colD_push =
 assign kernel_colD_vld_o = kernel_colD_vld;
 assign kernel_colD_push_o = kernel_colD_push;
 assign kernel_colD_pos_o = kernel_colD_pos;
+assign kernel_colD_ch_o = kernel_colD_ch;
 assign kernel_colD_data_o = kernel_colD_data;
 
+assign tb_lb_skid_vld_o = lb_skid_vld;
+assign tb_lb_skid_sel_o = lb_skid_sel;
+
 endmodule : conv_cntrl
 
 `define FLOPS_UNDEF
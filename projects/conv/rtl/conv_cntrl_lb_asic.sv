@@ -41,7 +41,7 @@ module conv_cntrl_lb_asic (
 
   input wire logic                          push_i
 , input wire logic                          pop_i
-, input wire conv_pkg::pixel_t              dat_i
+, input wire conv_pkg::pixel_group_t        dat_i
 , input wire logic                          sol_i
 , input wire logic                          eol_i
 
@@ -51,7 +51,17 @@ module conv_cntrl_lb_asic (
 //                                                                            //
 // -------------------------------------------------------------------------- //
 
-, output conv_pkg::pixel_t                  colD_o
+, output conv_pkg::pixel_group_t            colD_o
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Observation (testbench coverage)                                           //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, output wire logic                         tb_skid_vld_o
+, output wire logic [conv_pkg::LB_ASIC_GROUPS_PER_WORD_N - 1:0]
+                                            tb_skid_sel_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -69,20 +79,18 @@ module conv_cntrl_lb_asic (
 //                                                                           //
 // ========================================================================= //
 
-// Nominal SRAM word with for ASIC implementation. In general, SRAM
-// compilers do not allow small word widths (i.e. a single pixel), so
-// we define a larger word with and then inject additional logic to pack
-// and unpack pixel data.
-localparam int SRAM_W = 128;
+// Nominal SRAM word with for ASIC implementation (see conv_pkg). Pixel
+// groups (conv_pkg::PPC pixels) are packed into, and unpacked from, SRAM
+// words.
+localparam int SRAM_W = conv_pkg::LB_ASIC_SRAM_W;
 typedef logic [SRAM_W-1:0] sram_word_t;
 
-// Pixels per SRAM word.
-localparam int PIXELS_PER_WORD_N =
-  common_pkg::ceil(SRAM_W, conv_pkg::PIXEL_W);
+// Pixel groups per SRAM word.
+localparam int GROUPS_PER_WORD_N = conv_pkg::LB_ASIC_GROUPS_PER_WORD_N;
 
 // Maximum number of SRAM words
 localparam int SRAM_WORDS_N =
-  common_pkg::ceil(conv_pkg::IMAGE_MAX_W, PIXELS_PER_WORD_N);
+  common_pkg::ceil(conv_pkg::LB_PIXELS_N, GROUPS_PER_WORD_N);
 
 // ------------------------------------------------------------------------- //
 // Address calculations
@@ -97,20 +105,23 @@ logic                                       addr_en;
 // ------------------------------------------------------------------------- //
 // Push Path
 
-logic [PIXELS_PER_WORD_N-2:0]               word_en;
-conv_pkg::pixel_t [PIXELS_PER_WORD_N-2:0]   word_w;
-conv_pkg::pixel_t [PIXELS_PER_WORD_N-2:0]   word_r;
-logic [PIXELS_PER_WORD_N-2:0]               word_vld_w;
-logic [PIXELS_PER_WORD_N-2:0]               word_vld_r;
-logic [PIXELS_PER_WORD_N-1:0]               word_admit_dat;
+logic [GROUPS_PER_WORD_N-2:0]               word_en;
+conv_pkg::pixel_group_t [GROUPS_PER_WORD_N-2:0]
+                                            word_w;
+conv_pkg::pixel_group_t [GROUPS_PER_WORD_N-2:0]
+                                            word_r;
+logic [GROUPS_PER_WORD_N-2:0]               word_vld_w;
+logic [GROUPS_PER_WORD_N-2:0]               word_vld_r;
+logic [GROUPS_PER_WORD_N-1:0]               word_admit_dat;
 
 logic                                       word_is_last;
 logic                                       word_next_en;
-`P_DFFE(logic [PIXELS_PER_WORD_N-1:0], word_next, word_next_en, clk);
-logic [PIXELS_PER_WORD_N-1:0]               word_next;
+`P_DFFE(logic [GROUPS_PER_WORD_N-1:0], word_next, word_next_en, clk);
+logic [GROUPS_PER_WORD_N-1:0]               word_next;
 
 // Final composed word for SRAM interface.
-conv_pkg::pixel_t [PIXELS_PER_WORD_N-1:0]  word_din;
+conv_pkg::pixel_group_t [GROUPS_PER_WORD_N-1:0]
+                                           word_din;
 logic                                      advance_push;
 
 // ------------------------------------------------------------------------- //
@@ -144,11 +155,11 @@ logic                                      skid_vld_kill;
 `P_DFFR(logic, skid_vld, 'b0, clk, arst_n);
 
 logic                                      skid_sel_en;
-`P_DFFE(logic [PIXELS_PER_WORD_N-1:0], skid_sel, skid_sel_en, clk);
-conv_pkg::pixel_t                          skid_demux;
+`P_DFFE(logic [GROUPS_PER_WORD_N-1:0], skid_sel, skid_sel_en, clk);
+conv_pkg::pixel_group_t                    skid_demux;
 logic                                      skid_demux_bypass;
 logic                                      colD_en;
-`P_DFFE(conv_pkg::pixel_t, colD, colD_en, clk);
+`P_DFFE(conv_pkg::pixel_group_t, colD, colD_en, clk);
 
 // ========================================================================= //
 //                                                                           //
@@ -159,9 +170,9 @@ logic                                      colD_en;
 // ------------------------------------------------------------------------- //
 // Push Path
 
-// One-Hot pointer to the next pixel position within the SRAM word.
+// One-Hot pointer to the next pixel group position within the SRAM word.
 //
-assign word_is_last = word_next_r[PIXELS_PER_WORD_N - 1] | eol_i;
+assign word_is_last = word_next_r[GROUPS_PER_WORD_N - 1] | eol_i;
 
 assign word_next_en = push_i;
 assign word_next_w = sol_i ? 'b10 : word_is_last ? 'b01 : (word_next_r << 1);
@@ -171,13 +182,13 @@ assign word_next = sol_i ? 'b1 : word_next_r;
 `P_ASSERT_CR(clk, arst_n, $onehot0(word_next));
 
 // Logic to compose an SRAM word for some arbitrary word width and
-// line buffer pixel width.
+// pixel group width.
 //
-for (genvar i = 0; i < PIXELS_PER_WORD_N; i++) begin: din_pack_GEN
+for (genvar i = 0; i < GROUPS_PER_WORD_N; i++) begin: din_pack_GEN
 
-if (i < (PIXELS_PER_WORD_N - 1)) begin : reg_GEN
+if (i < (GROUPS_PER_WORD_N - 1)) begin : reg_GEN
 
-  dffe #(.W(conv_pkg::PIXEL_W)) u_word_reg (
+  dffe #(.W(conv_pkg::PIXEL_GROUP_W)) u_word_reg (
     .d(word_w[i]), .q(word_r[i]), .en(word_en[i]), .clk(clk)
   );
 
@@ -193,7 +204,7 @@ if (i < (PIXELS_PER_WORD_N - 1)) begin : reg_GEN
 
 end: reg_GEN
 
-if (i < (PIXELS_PER_WORD_N - 1)) begin : not_last_GEN
+if (i < (GROUPS_PER_WORD_N - 1)) begin : not_last_GEN
 
   assign word_admit_dat[i] =
     eol_i & word_next[i] & (~word_vld_r[i]);
@@ -226,9 +237,9 @@ assign advance_push =
 // stalled, and (3) the skid buffer is not full or the skid buffer is
 // being drained and is reading the last pixel.
 assign advance_pop_pre = 
-  pop_i & (~skid_vld_r | skid_sel_r[PIXELS_PER_WORD_N - 1]);
+  pop_i & (~skid_vld_r | skid_sel_r[GROUPS_PER_WORD_N - 1]);
 
-if (PIXELS_PER_WORD_N > 1) begin: advance_pop_multi_GEN
+if (GROUPS_PER_WORD_N > 1) begin: advance_pop_multi_GEN
   // For multi-pixel words, only advance pop when the output
   // of the SRAM is invalid, or, whenever the last pixel of the line
   // is present at the output of the SRAM.
@@ -288,7 +299,7 @@ assign skid_w = dout;
 // valid when (2) stalled or when not reading the last pixel.
 assign skid_vld_pre =
     pop_pipe_r.dout_vld
-  | skid_vld_r & (~pop_pipe_r.pop | ~skid_sel_r[PIXELS_PER_WORD_N - 1]);
+  | skid_vld_r & (~pop_pipe_r.pop | ~skid_sel_r[GROUPS_PER_WORD_N - 1]);
 
 assign skid_vld_kill =
   skid_vld_r & pop_pipe_r.pop & pop_pipe_r.eol;
@@ -306,10 +317,10 @@ assign skid_sel_en = pop_pipe_r.dout_vld | (skid_vld_r & pop_pipe_r.pop);
 assign skid_sel_w = 
     pop_pipe_r.dout_vld
   ? ( pop_pipe_r.pop ? 'b10 : 'b01)                                // (1)
-  : {skid_sel_r[PIXELS_PER_WORD_N-2:0], 1'b0};                     // (2)
+  : {skid_sel_r[GROUPS_PER_WORD_N-2:0], 1'b0};                     // (2)
 
 // Mux out selected pixel.
-mux #(.N(PIXELS_PER_WORD_N), .W(conv_pkg::PIXEL_W)) u_skid_mux (
+mux #(.N(GROUPS_PER_WORD_N), .W(conv_pkg::PIXEL_GROUP_W)) u_skid_mux (
   .x_i             (skid_r)
 , .sel_i           (skid_sel_r)
 , .y_o             (skid_demux)
@@ -321,7 +332,7 @@ assign skid_demux_bypass = skid_en;
 
 // On bypass, first pixel arrives from SRAM output directly.
 assign colD_w =
-  skid_demux_bypass ? dout[conv_pkg::PIXEL_W - 1:0] : skid_demux;
+  skid_demux_bypass ? dout[conv_pkg::PIXEL_GROUP_W - 1:0] : skid_demux;
 
 //
 assign colD_en = pop_i & (skid_en | skid_vld_r);
@@ -334,6 +345,9 @@ assign colD_en = pop_i & (skid_en | skid_vld_r);
 
 assign colD_o = colD_r;
 
+assign tb_skid_vld_o = skid_vld_r;
+assign tb_skid_sel_o = skid_sel_r;
+
 endmodule : conv_cntrl_lb_asic
 
 `define FLOPS_UNDEF
@@ -27,6 +27,7 @@
 
 `include "common_defs.svh"
 `include "conv_pkg.svh"
+`include "common_pkg.svh"
 `include "flops.svh"
 
 module conv_cntrl_lb_fpga (
@@ -39,7 +40,7 @@ module conv_cntrl_lb_fpga (
 
   input wire logic                          push_i
 , input wire logic                          pop_i
-, input wire conv_pkg::pixel_t              dat_i
+, input wire conv_pkg::pixel_group_t        dat_i
 , input wire logic                          sol_i
 , input wire logic                          eol_i
 
@@ -49,7 +50,7 @@ module conv_cntrl_lb_fpga (
 //                                                                            //
 // -------------------------------------------------------------------------- //
 
-, output conv_pkg::pixel_t                  colD_o
+, output conv_pkg::pixel_group_t            colD_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -72,14 +73,21 @@ module conv_cntrl_lb_fpga (
 //                                                                           //
 // ========================================================================= //
 
-localparam ADDR_W = $clog2(conv_pkg::IMAGE_MAX_W);
+// BRAM words are one pixel group wide; one word per beat.
+localparam int WORDS_N =
+  common_pkg::ceil(conv_pkg::LB_PIXELS_N, conv_pkg::PPC);
+
+localparam ADDR_W = $clog2(WORDS_N);
 typedef logic [ADDR_W-1:0] addr_t;
 
 logic                                  addr_en;
 `P_DFFE(addr_t, addr, addr_en, clk);
 addr_t                                 addr;
-logic                                  wen;
-logic                                  ren;
+
+conv_pkg::pixel_group_t                dout;
+
+logic                                  colD_en;
+`P_DFFE(conv_pkg::pixel_group_t, colD, colD_en, clk);
 
 // ========================================================================= //
 //                                                                           //
@@ -87,54 +95,63 @@ logic                                  ren;
 //                                                                           //
 // ========================================================================= //
 
-// End-of-line occurs on the final pixel of the line. Otherwise, on
-// Start-of-Frame, reset value of 'b1, as the first slot is set below.
-assign addr_w = (sol_i ? 'b1 : (eol_i ? 'b0 : addr_r + 'b1));
-assign addr_en = (push_i != '0);
-
-// Start-of-frame is coincident with the first push. The address must
-// therefore reset on the cycle cycle.
-assign addr = sol_i ? 'b0 : addr_w;
+// ------------------------------------------------------------------------- //
+// Address calculation
 
-assign wen = push_i;
+// A bank is either pushed or popped, a word per beat, and lines always start
+// at the first word. Start-of-line is coincident with the first push (pop)
+// of the line; the address must therefore reset on the same cycle.
+assign addr = sol_i ? '0 : addr_r;
+assign addr_w = addr + 'b1;
+assign addr_en = (push_i | pop_i);
 
-assign ren = (push_i & pop_i);
-
-`P_DFFR(logic, dout_vld, 'b0, clk, arst_n);
-
-assign dout_vld_w = ren;
+// ------------------------------------------------------------------------- //
+// BRAM instance.
 
 // FPGA BRAM instance offer true dual-port operation. Additionally,
 // they internally resolve read/write collisions without further logic.
 // These features are not seen on ASIC SRAM macros, hence the different
 // implementations between FPGA and ASIC versions of the line buffer.
+//
+// Pushes and pops of a bank are mutually exclusive; collisions therefore do
+// not arise.
 
 generic_bram #(
-  .WORD_W           (conv_pkg::PIXEL_W)
-, .WORDS_N          (conv_pkg::IMAGE_MAX_W)
+  .WORD_W           (conv_pkg::PIXEL_GROUP_W)
+, .WORDS_N          (WORDS_N)
 , .HOLD_DOUT        (1'b1)
 , .COLLISION        ("DEFER_WRITE")
 ) u_generic_bram (
 // Port A: Write
-  .cea              (wen)
+  .cea              (push_i)
 , .addra            (addr)
 , .dina             (dat_i)
 , .rnwa             (1'b0)
-, .douta            (/* UNSUSED */)
+, .douta            (/* UNUSED */)
 // Port B: Read
-, .ceb              (ren)
+, .ceb              (pop_i)
 , .addrb            (addr)
 , .dinb             ('b0)
 , .rnwb             (1'b1)
-, .doutb            (colD_w)
+, .doutb            (dout)
+//
+, .clk              (clk)
 );
 
-// Introduce an additional flops stage to latency match ASIC version.
+// ------------------------------------------------------------------------- //
+// Output stage.
 
-logic                             colD_en;
-`P_DFFE(conv_pkg::pixel_t, colD, colD_en, clk);
-assign colD_en = (dout_vld_r != '0);
+// Introduce an additional flops stage to latency match ASIC version. As
+// there, the group read on a pop is presented at colD upon the subsequent
+// pop (i.e. once the datapath has advanced). In the interim, stalls are
+// absorbed by BRAM, which retains dout in the absence of further reads,
+// taking the place of the skid buffer of the ASIC version.
+assign colD_en = pop_i;
+assign colD_w = dout;
 
+// Lines are delimited by start-of-line alone, and no state requires reset.
+logic UNUSED_lb;
+assign UNUSED_lb = ^{eol_i, arst_n};
 
 // ========================================================================= //
 //                                                                           //
@@ -142,7 +159,7 @@ assign colD_en = (dout_vld_r != '0);
 //                                                                           //
 // ========================================================================= //
 
-assign colD_o = 'b0;
+assign colD_o = colD_r;
 
 endmodule : conv_cntrl_lb_fpga
 
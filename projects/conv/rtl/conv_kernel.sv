@@ -38,9 +38,11 @@ module conv_kernel (
 // -------------------------------------------------------------------------- //
 
   input wire logic                               colD_vld_i
-, input wire logic [4:0]                         colD_push_i
-, input conv_pkg::pixel_span_t                   colD_dat_i
-, input conv_pkg::kernel_pos_t                   colD_pos_i
+, input wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                                                 colD_push_i
+, input conv_pkg::pixel_group_span_t             colD_dat_i
+, input conv_pkg::kernel_pos_group_t             colD_pos_i
+, input conv_pkg::channel_t                      colD_ch_i
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -49,8 +51,9 @@ module conv_kernel (
 // -------------------------------------------------------------------------- //
 
 , output wire logic                              kernel_vld_o
-, output conv_pkg::kernel_t                      kernel_dat_o
-, output conv_pkg::kernel_pos_t                  kernel_pos_o
+, output conv_pkg::kernel_group_t                kernel_dat_o
+, output conv_pkg::kernel_pos_group_t            kernel_pos_o
+, output conv_pkg::channel_t                     kernel_ch_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -70,17 +73,32 @@ module conv_kernel (
 
 logic                                  dp_stall;
 
-conv_pkg::pixel_t
+// Kernels are emitted in groups aligned to the ingress pixel groups
+// (see conv_pkg for window geometry). Columns of interleaved channels
+// are interleaved, such that column j of a channel is retained at beat
+// (j * C) of the row history.
+localparam int C = conv_pkg::CHANNEL_N;
+localparam int DP_POS_N = conv_pkg::KERNEL_POS_DELAY_N;
+localparam int LANE0_OFF_N = conv_pkg::KERNEL_LANE0_OFF_N;
+localparam int DP_ROW_N = conv_pkg::KERNEL_HISTORY_N;
+
+localparam int ROW_PIXELS_N = (DP_ROW_N + 1) * conv_pkg::PPC;
+
+conv_pkg::pixel_group_t
   [conv_pkg::KERNEL_DIAMETER_N - 1:0]
-  [conv_pkg::KERNEL_DIAMETER_N - 1:1]  dp_pixel_row_dat_r;
+  [DP_ROW_N * C:1]                     dp_pixel_row_dat_r;
 
-localparam int DP_POS_N = 2;
+// Retained pixels of each row, most recent (east-most) first.
+conv_pkg::pixel_t
+  [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+  [ROW_PIXELS_N - 1:0]                 row_pixels;
 
-conv_pkg::kernel_t                     kernel_dat;
+conv_pkg::kernel_group_t               kernel_dat;
 
 typedef struct packed {
   logic                         vld;
-  conv_pkg::kernel_pos_t        pos;
+  conv_pkg::kernel_pos_group_t  pos;
+  conv_pkg::channel_t           ch;
 } dp_cntrl_t;
 
 localparam int DP_CNTRL_W = $bits(dp_cntrl_t);
@@ -101,15 +119,15 @@ dp_cntrl_t                             dp_cntrl_out;
 assign dp_stall = (~colD_vld_i);
 
 assign dp_cntrl_vld_in = colD_vld_i;
-assign dp_cntrl_in = '{vld: colD_vld_i, pos: colD_pos_i};
+assign dp_cntrl_in = '{vld: colD_vld_i, pos: colD_pos_i, ch: colD_ch_i};
 
 // ------------------------------------------------------------------------- //
 //
 for (genvar n = 0; n < conv_pkg::KERNEL_DIAMETER_N; n++) begin: n_GEN
 
 dp #(
-  .W(conv_pkg::PIXEL_W)
-, .N(conv_pkg::KERNEL_DIAMETER_N - 1)
+  .W(conv_pkg::PIXEL_GROUP_W)
+, .N(DP_ROW_N * C)
 ) u_dp_pixel_row (
   .vld_i                    (colD_push_i[n])
 , .dat_i                    (colD_dat_i[n])  
@@ -125,11 +143,35 @@ dp #(
 , .arst_n                   (arst_n)
 );
 
+// Flatten row history such that pixel i lies i columns west of the most
+// recent pixel.
+for (genvar j = 0; j < (DP_ROW_N + 1); j++) begin: row_pixels_j_GEN
+
+for (genvar l = 0; l < conv_pkg::PPC; l++) begin: row_pixels_l_GEN
+
+if (j == 0) begin: colD_GEN
+assign row_pixels[n][conv_pkg::PPC - 1 - l] = colD_dat_i[n][l];
+end: colD_GEN
+else begin: dp_GEN
+assign row_pixels[n][(j * conv_pkg::PPC) + (conv_pkg::PPC - 1 - l)] =
+  dp_pixel_row_dat_r[n][j * C][l];
+end: dp_GEN
+
+end: row_pixels_l_GEN
+
+end: row_pixels_j_GEN
+
+// Intervening beats of the history hold columns of other channels.
+if (C > 1) begin: channel_GEN
+logic UNUSED_dp_pixel_row_dat_r;
+assign UNUSED_dp_pixel_row_dat_r = ^dp_pixel_row_dat_r[n];
+end: channel_GEN
+
 end: n_GEN
 
 dp #(
   .W(DP_CNTRL_W)
-, .N(DP_POS_N)
+, .N(DP_POS_N * C)
 ) u_dp_cntrl (
   .vld_i                    (dp_cntrl_vld_in)
 , .dat_i                    (dp_cntrl_in)  
@@ -147,12 +189,18 @@ dp #(
 
 // ------------------------------------------------------------------------- //
 //
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: kernel_dat_p_GEN
+
 for (genvar m = 0; m < conv_pkg::KERNEL_DIAMETER_N; m++) begin: kernel_dat_GEN
 
-assign kernel_dat[m] = { dp_pixel_row_dat_r[m], colD_dat_i[m] };
+assign kernel_dat[p][m] =
+  row_pixels[m][LANE0_OFF_N - p + conv_pkg::KERNEL_DIAMETER_N - 1:
+                LANE0_OFF_N - p];
 
 end: kernel_dat_GEN
 
+end: kernel_dat_p_GEN
+
 // ========================================================================= //
 //                                                                           //
 // Outputs                                                                   //
@@ -162,6 +210,7 @@ end: kernel_dat_GEN
 assign kernel_vld_o = (~dp_stall) & dp_cntrl_vld_out & dp_cntrl_out.vld;
 assign kernel_dat_o = kernel_dat;
 assign kernel_pos_o = dp_cntrl_out.pos;
+assign kernel_ch_o = dp_cntrl_out.ch;
 
 endmodule : conv_kernel
 
@@ -0,0 +1,233 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+`include "common_defs.svh"
+`include "conv_pkg.svh"
+`include "flops.svh"
+
+// Pipelined multiply-accumulate (filter) stage. Each kernel of the group is
+// convolved with a common set of programmable signed coefficients. The
+// accumulated result is normalized by a right shift (with round-half-up),
+// and saturated to the pixel range.
+//
+// Pipeline:
+//
+//  1: Multiply; COEFF_N products per lane.
+//
+//  2: Accumulate; reduction of products and addition of rounding constant.
+//
+//     Output: Shift and saturate (combinational, registered by the consumer).
+//
+// The pipeline advances only when not stalled, in which case bubbles are
+// also advanced. The channel ID of each kernel is carried alongside.
+
+module conv_mac (
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Kernel                                                                     //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+  input wire logic                               vld_i
+, input conv_pkg::kernel_group_t                 kernel_i
+, input conv_pkg::channel_t                      ch_i
+
+, input wire logic                               stall_i
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Coefficient Load                                                           //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, input wire logic                               coeff_vld_i
+, input wire logic [conv_pkg::COEFF_IDX_W - 1:0] coeff_idx_i
+, input wire conv_pkg::coeff_t                   coeff_dat_i
+
+, input wire logic [conv_pkg::MAC_SHIFT_W - 1:0] shift_i
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Filtered Pixel                                                             //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, output wire logic                              vld_o
+, output conv_pkg::pixel_group_t                 dat_o
+, output conv_pkg::channel_t                     ch_o
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Misc.                                                                      //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, input wire logic                               clk
+, input wire logic                               arst_n
+);
+
+// ========================================================================= //
+//                                                                           //
+// Wire(s)                                                                   //
+//                                                                           //
+// ========================================================================= //
+
+// Product of an unsigned pixel and a signed coefficient.
+localparam int PROD_W = (conv_pkg::PIXEL_W + 1) + conv_pkg::COEFF_W;
+typedef logic signed [PROD_W - 1:0] prod_t;
+
+typedef prod_t
+  [conv_pkg::PPC - 1:0]
+  [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+  [conv_pkg::KERNEL_DIAMETER_N - 1:0] prod_group_t;
+
+// Accumulator, with additional headroom for the rounding constant.
+localparam int ACC_W = conv_pkg::MAC_ACC_W + 1;
+typedef logic signed [ACC_W - 1:0] acc_t;
+
+typedef acc_t [conv_pkg::PPC - 1:0] acc_group_t;
+
+// Coefficients
+logic                                  coeff_en;
+`P_DFFRE(conv_pkg::coeff_kernel_t, coeff, coeff_en, conv_pkg::COEFF_INIT,
+  clk, arst_n);
+
+// Stage 1: Multiply
+logic                                  prod_en;
+`P_DFFR(logic, prod_vld, 1'b0, clk, arst_n);
+`P_DFFE(prod_group_t, prod, prod_en, clk);
+`P_DFFE(conv_pkg::channel_t, prod_ch, prod_en, clk);
+
+// Stage 2: Accumulate
+logic                                  acc_en;
+`P_DFFR(logic, acc_vld, 1'b0, clk, arst_n);
+`P_DFFE(acc_group_t, acc, acc_en, clk);
+`P_DFFE(conv_pkg::channel_t, acc_ch, acc_en, clk);
+acc_t                                  acc_rnd;
+
+// Output: Shift and saturate
+acc_group_t                            acc_shifted;
+conv_pkg::pixel_group_t                dat;
+
+// ========================================================================= //
+//                                                                           //
+// Logic                                                                     //
+//                                                                           //
+// ========================================================================= //
+
+// ------------------------------------------------------------------------- //
+// Coefficient load.
+
+assign coeff_en = coeff_vld_i;
+
+always_comb begin: coeff_PROC
+
+  coeff_w = coeff_r;
+  coeff_w[coeff_idx_i / conv_pkg::KERNEL_DIAMETER_N]
+         [coeff_idx_i % conv_pkg::KERNEL_DIAMETER_N] = coeff_dat_i;
+
+end: coeff_PROC
+
+// ------------------------------------------------------------------------- //
+// Stage 1: Multiply
+
+assign prod_en = vld_i & (~stall_i);
+assign prod_vld_w = stall_i ? prod_vld_r : vld_i;
+assign prod_ch_w = ch_i;
+
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: prod_p_GEN
+
+for (genvar m = 0; m < conv_pkg::KERNEL_DIAMETER_N; m++) begin: prod_m_GEN
+
+for (genvar n = 0; n < conv_pkg::KERNEL_DIAMETER_N; n++) begin: prod_n_GEN
+
+assign prod_w[p][m][n] =
+  $signed({1'b0, kernel_i[p][m][n]}) * $signed(coeff_r[m][n]);
+
+end: prod_n_GEN
+
+end: prod_m_GEN
+
+end: prod_p_GEN
+
+// ------------------------------------------------------------------------- //
+// Stage 2: Accumulate
+//
+// Reduction is expressed as a sum; synthesis maps this to an adder tree.
+
+assign acc_en = prod_vld_r & (~stall_i);
+assign acc_vld_w = stall_i ? acc_vld_r : prod_vld_r;
+assign acc_ch_w = prod_ch_r;
+
+// Round-half-up constant; half of the LSB retained after normalization.
+assign acc_rnd = (shift_i == '0) ? '0 : (acc_t'(1) << (shift_i - 1'b1));
+
+always_comb begin: acc_PROC
+
+  for (int p = 0; p < conv_pkg::PPC; p++) begin
+    acc_w[p] = acc_rnd;
+    for (int m = 0; m < conv_pkg::KERNEL_DIAMETER_N; m++) begin
+      for (int n = 0; n < conv_pkg::KERNEL_DIAMETER_N; n++) begin
+        acc_w[p] = acc_w[p] + acc_t'($signed(prod_r[p][m][n]));
+      end
+    end
+  end
+
+end: acc_PROC
+
+// ------------------------------------------------------------------------- //
+// Output: Shift and saturate.
+
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: sat_GEN
+
+assign acc_shifted[p] = $signed(acc_r[p]) >>> shift_i;
+
+assign dat[p] =
+    acc_shifted[p][ACC_W - 1]
+  ? '0
+  : ((acc_shifted[p] > acc_t'({conv_pkg::PIXEL_W{1'b1}}))
+     ? '1
+     : acc_shifted[p][conv_pkg::PIXEL_W - 1:0]);
+
+end: sat_GEN
+
+// ========================================================================= //
+//                                                                           //
+// Outputs                                                                   //
+//                                                                           //
+// ========================================================================= //
+
+assign vld_o = acc_vld_r;
+assign dat_o = dat;
+assign ch_o = acc_ch_r;
+
+endmodule : conv_mac
+
+`define FLOPS_UNDEF
+`include "flops.svh"
+`undef FLOPS_UNDEF
@@ -57,15 +57,8 @@ module conv_mask_zp (
 
 conv_pkg::kernel_t                    kernel_masked;
 
-logic                                 kill_col_a;
-logic                                 kill_col_b;
-logic                                 kill_col_c;
-logic                                 kill_col_d;
-
-logic                                 kill_row_a;
-logic                                 kill_row_b;
-logic                                 kill_row_c;
-logic                                 kill_row_d;
+logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]  kill_col;
+logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]  kill_row;
 
 logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
       [conv_pkg::KERNEL_DIAMETER_N - 1:0]  zero_pad;
@@ -77,32 +70,36 @@ logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
 // ========================================================================= //
 
 // -------------------------------------------------------------------------- //
-// Column masking:
+// Column masking (KERNEL_DIAMETER_N == 5):
 
 //  A B X C D
 //  A B X C D
 //  A B O C D
 //  A B X C D
 //  A B X C D
+//
+//  A: W1 | W2, B: W2, C: E2, D: E1 | E2
 
-assign kill_col_a = (kernel_pos_i.w1 | kernel_pos_i.w2);
-assign kill_col_b =                    kernel_pos_i.w2;
-assign kill_col_c =                    kernel_pos_i.e2;
-assign kill_col_d = (kernel_pos_i.e1 | kernel_pos_i.e2);
-
-// -------------------------------------------------------------------------- //
-// Row masking:
+// Row masking (KERNEL_DIAMETER_N == 5):
 
 //   A A A A A
 //   B B B B B
 //   X X O X X
 //   C C C C C
 //   D D D D D
+//
+//  A: N1 | N2, B: N2, C: S2, D: S1 | S2
+//
+// (Generally, see conv_pkg::kernel_pos_kill.)
+
+for (genvar i = 0; i < conv_pkg::KERNEL_DIAMETER_N; i++) begin: kill_GEN
+
+assign kill_col[i] =
+  conv_pkg::kernel_pos_kill(kernel_pos_i.w, kernel_pos_i.e, i);
+assign kill_row[i] =
+  conv_pkg::kernel_pos_kill(kernel_pos_i.n, kernel_pos_i.s, i);
 
-assign kill_row_a = (kernel_pos_i.n1 | kernel_pos_i.n2);
-assign kill_row_b =                    kernel_pos_i.n2;
-assign kill_row_c =                    kernel_pos_i.s2;
-assign kill_row_d = (kernel_pos_i.s1 | kernel_pos_i.s2);
+end: kill_GEN
 
 // -------------------------------------------------------------------------- //
 
@@ -112,15 +109,7 @@ for (genvar n = 0; n < conv_pkg::KERNEL_DIAMETER_N; n++) begin: zero_pad_n_GEN
 
 // Compute zero-pad mask.
 //
-assign zero_pad[m][n] = 
-    ((m == 4) ? kill_row_a : 1'b0) |
-    ((m == 3) ? kill_row_b : 1'b0) |
-    ((m == 1) ? kill_row_c : 1'b0) |
-    ((m == 0) ? kill_row_d : 1'b0) |
-    ((n == 4) ? kill_col_a : 1'b0) |
-    ((n == 3) ? kill_col_b : 1'b0) |
-    ((n == 1) ? kill_col_c : 1'b0) |
-    ((n == 0) ? kill_col_d : 1'b0);
+assign zero_pad[m][n] = kill_row[m] | kill_col[n];
 
 end: zero_pad_n_GEN
 
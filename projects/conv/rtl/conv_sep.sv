@@ -0,0 +1,402 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+`include "common_defs.svh"
+`include "conv_pkg.svh"
+`include "flops.svh"
+
+// Separable (rank-1) filter. The filter is decomposed into a vertical
+// KERNEL_DIAMETER_N-tap filter, applied to each column as it arrives from
+// the line buffer, followed by a horizontal KERNEL_DIAMETER_N-tap filter
+// applied across the retained history of vertical results. Equivalent to
+// conv_mac with coefficients [m][n] = v[m] * h[n], at 2 * KERNEL_DIAMETER_N
+// multipliers per lane (rather than KERNEL_DIAMETER_N^2), and a single
+// retained row (rather than KERNEL_DIAMETER_N).
+//
+// Zero-padding is applied in place: rows outside of the image are excluded
+// from the vertical sum; columns outside of the image are excluded from the
+// horizontal sum. Intermediate results are retained at full precision such
+// that the result is bit-exact with respect to the equivalent 2D filter.
+//
+// Pipeline:
+//
+//  0: Vertical; column reduction (combinational, registered into the
+//     history).
+//
+//  1: Horizontal multiply; KERNEL_DIAMETER_N products per lane.
+//
+//  2: Accumulate; reduction of products and addition of rounding constant.
+//
+//     Output: Shift and saturate (combinational, registered by the consumer).
+//
+// The history advances with each valid column (as conv_kernel); the
+// subsequent stages advance only when not stalled (as conv_mac).
+
+module conv_sep (
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Input                                                                      //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+  input wire logic                               colD_vld_i
+, input conv_pkg::pixel_group_span_t             colD_dat_i
+, input conv_pkg::kernel_pos_group_t             colD_pos_i
+, input conv_pkg::channel_t                      colD_ch_i
+
+, input wire logic                               stall_i
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Coefficient Load                                                           //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, input wire logic                               coeff_vld_i
+, input wire logic [conv_pkg::COEFF_IDX_W - 1:0] coeff_idx_i
+, input wire conv_pkg::coeff_t                   coeff_dat_i
+
+, input wire logic [conv_pkg::MAC_SHIFT_W - 1:0] shift_i
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Filtered Pixel                                                             //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, output wire logic                              vld_o
+, output conv_pkg::pixel_group_t                 dat_o
+, output conv_pkg::channel_t                     ch_o
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Misc.                                                                      //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, input wire logic                               clk
+, input wire logic                               arst_n
+);
+
+// ========================================================================= //
+//                                                                           //
+// Wire(s)                                                                   //
+//                                                                           //
+// ========================================================================= //
+
+// Results of interleaved channels are interleaved (see conv_kernel).
+localparam int C = conv_pkg::CHANNEL_N;
+localparam int DP_POS_N = conv_pkg::KERNEL_POS_DELAY_N;
+localparam int LANE0_OFF_N = conv_pkg::KERNEL_LANE0_OFF_N;
+localparam int DP_ROW_N = conv_pkg::KERNEL_HISTORY_N;
+
+localparam int ROW_V_N = (DP_ROW_N + 1) * conv_pkg::PPC;
+
+// Vertical result.
+typedef logic signed [conv_pkg::SEP_V_W - 1:0] v_t;
+
+typedef v_t [conv_pkg::PPC - 1:0] v_group_t;
+
+localparam int V_GROUP_W = $bits(v_group_t);
+
+// Product of a vertical result and a signed tap.
+localparam int PROD_W = conv_pkg::SEP_V_W + conv_pkg::COEFF_W;
+typedef logic signed [PROD_W - 1:0] prod_t;
+
+typedef prod_t
+  [conv_pkg::PPC - 1:0]
+  [conv_pkg::KERNEL_DIAMETER_N - 1:0] prod_group_t;
+
+// Accumulator, with additional headroom for the rounding constant.
+localparam int ACC_W = conv_pkg::SEP_ACC_W + 1;
+typedef logic signed [ACC_W - 1:0] acc_t;
+
+typedef acc_t [conv_pkg::PPC - 1:0] acc_group_t;
+
+// Taps
+logic                                  coeff_v_en;
+`P_DFFRE(conv_pkg::coeff_span_t, coeff_v, coeff_v_en,
+  conv_pkg::SEP_COEFF_INIT, clk, arst_n);
+logic                                  coeff_h_en;
+`P_DFFRE(conv_pkg::coeff_span_t, coeff_h, coeff_h_en,
+  conv_pkg::SEP_COEFF_INIT, clk, arst_n);
+
+// Stage 0: Vertical
+logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]  kill_row;
+v_group_t                              v;
+
+logic                                  dp_stall;
+
+v_group_t [DP_ROW_N * C:1]             dp_v_row_dat_r;
+
+// Retained vertical results, most recent (east-most) first.
+v_t [ROW_V_N - 1:0]                    row_v;
+
+typedef struct packed {
+  logic                         vld;
+  conv_pkg::kernel_pos_group_t  pos;
+  conv_pkg::channel_t           ch;
+} dp_cntrl_t;
+
+localparam int DP_CNTRL_W = $bits(dp_cntrl_t);
+
+dp_cntrl_t                             dp_cntrl_in;
+logic                                  dp_cntrl_vld_out;
+dp_cntrl_t                             dp_cntrl_out;
+
+logic                                  h_vld;
+v_t [conv_pkg::PPC - 1:0]
+    [conv_pkg::KERNEL_DIAMETER_N - 1:0] h_dat;
+
+// Stage 1: Horizontal multiply
+logic                                  prod_en;
+`P_DFFR(logic, prod_vld, 1'b0, clk, arst_n);
+`P_DFFE(prod_group_t, prod, prod_en, clk);
+`P_DFFE(conv_pkg::channel_t, prod_ch, prod_en, clk);
+
+// Stage 2: Accumulate
+logic                                  acc_en;
+`P_DFFR(logic, acc_vld, 1'b0, clk, arst_n);
+`P_DFFE(acc_group_t, acc, acc_en, clk);
+`P_DFFE(conv_pkg::channel_t, acc_ch, acc_en, clk);
+acc_t                                  acc_rnd;
+
+// Output: Shift and saturate
+acc_group_t                            acc_shifted;
+conv_pkg::pixel_group_t                dat;
+
+// ========================================================================= //
+//                                                                           //
+// Logic                                                                     //
+//                                                                           //
+// ========================================================================= //
+
+// ------------------------------------------------------------------------- //
+// Tap load; vertical taps occupy indices [0, KERNEL_DIAMETER_N), horizontal
+// taps the subsequent KERNEL_DIAMETER_N. Other indices are ignored.
+
+assign coeff_v_en =
+  coeff_vld_i & (coeff_idx_i < conv_pkg::KERNEL_DIAMETER_N);
+
+assign coeff_h_en =
+    coeff_vld_i
+  & (coeff_idx_i >= conv_pkg::KERNEL_DIAMETER_N)
+  & (coeff_idx_i < (2 * conv_pkg::KERNEL_DIAMETER_N));
+
+always_comb begin: coeff_PROC
+
+  coeff_v_w = coeff_v_r;
+  coeff_v_w[coeff_idx_i] = coeff_dat_i;
+
+  coeff_h_w = coeff_h_r;
+  coeff_h_w[coeff_idx_i - conv_pkg::KERNEL_DIAMETER_N] = coeff_dat_i;
+
+end: coeff_PROC
+
+// ------------------------------------------------------------------------- //
+// Stage 0: Vertical
+//
+// Row position is common to all lanes of the group (see conv_cntrl), and to
+// all columns of a kernel retained within the image. Row masking is
+// therefore applied once per column, before the reduction.
+
+for (genvar m = 0; m < conv_pkg::KERNEL_DIAMETER_N; m++) begin: kill_row_GEN
+
+assign kill_row[m] =
+  conv_pkg::kernel_pos_kill(colD_pos_i[0].n, colD_pos_i[0].s, m);
+
+end: kill_row_GEN
+
+always_comb begin: v_PROC
+
+  for (int p = 0; p < conv_pkg::PPC; p++) begin
+    v[p] = '0;
+    for (int m = 0; m < conv_pkg::KERNEL_DIAMETER_N; m++) begin
+      if (!kill_row[m])
+        v[p] = v[p] + v_t'(
+          $signed({1'b0, colD_dat_i[m][p]}) * $signed(coeff_v_r[m]));
+    end
+  end
+
+end: v_PROC
+
+// ------------------------------------------------------------------------- //
+// History of vertical results.
+
+assign dp_stall = (~colD_vld_i);
+
+assign dp_cntrl_in = '{vld: colD_vld_i, pos: colD_pos_i, ch: colD_ch_i};
+
+dp #(
+  .W(V_GROUP_W)
+, .N(DP_ROW_N * C)
+) u_dp_v_row (
+  .vld_i                    (colD_vld_i)
+, .dat_i                    (v)
+, .stall_i                  (dp_stall)
+//
+, .pipe_vld_o               ()
+, .pipe_dat_o               (dp_v_row_dat_r)
+//
+, .vld_o                    (/* UNUSED */)
+, .dat_o                    (/* UNUSED */)
+//
+, .clk                      (clk)
+, .arst_n                   (arst_n)
+);
+
+// Flatten history such that result i lies i columns west of the most recent
+// result.
+for (genvar j = 0; j < (DP_ROW_N + 1); j++) begin: row_v_j_GEN
+
+for (genvar l = 0; l < conv_pkg::PPC; l++) begin: row_v_l_GEN
+
+if (j == 0) begin: v_GEN
+assign row_v[conv_pkg::PPC - 1 - l] = v[l];
+end: v_GEN
+else begin: dp_GEN
+assign row_v[(j * conv_pkg::PPC) + (conv_pkg::PPC - 1 - l)] =
+  dp_v_row_dat_r[j * C][l];
+end: dp_GEN
+
+end: row_v_l_GEN
+
+end: row_v_j_GEN
+
+// Intervening beats of the history hold results of other channels.
+if (C > 1) begin: channel_GEN
+logic UNUSED_dp_v_row_dat_r;
+assign UNUSED_dp_v_row_dat_r = ^dp_v_row_dat_r;
+end: channel_GEN
+
+dp #(
+  .W(DP_CNTRL_W)
+, .N(DP_POS_N * C)
+) u_dp_cntrl (
+  .vld_i                    (colD_vld_i)
+, .dat_i                    (dp_cntrl_in)
+, .stall_i                  (dp_stall)
+//
+, .pipe_vld_o               (/* UNUSED */)
+, .pipe_dat_o               (/* UNUSED */)
+//
+, .vld_o                    (dp_cntrl_vld_out)
+, .dat_o                    (dp_cntrl_out)
+//
+, .clk                      (clk)
+, .arst_n                   (arst_n)
+);
+
+// Horizontal window of each lane (as conv_kernel), with column masking (as
+// conv_mask_zp).
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: h_dat_p_GEN
+
+for (genvar n = 0; n < conv_pkg::KERNEL_DIAMETER_N; n++) begin: h_dat_n_GEN
+
+logic kill_col;
+
+assign kill_col =
+  conv_pkg::kernel_pos_kill(dp_cntrl_out.pos[p].w, dp_cntrl_out.pos[p].e, n);
+
+assign h_dat[p][n] = kill_col ? '0 : row_v[LANE0_OFF_N - p + n];
+
+end: h_dat_n_GEN
+
+end: h_dat_p_GEN
+
+assign h_vld = (~dp_stall) & dp_cntrl_vld_out & dp_cntrl_out.vld;
+
+// ------------------------------------------------------------------------- //
+// Stage 1: Horizontal multiply
+
+assign prod_en = h_vld & (~stall_i);
+assign prod_vld_w = stall_i ? prod_vld_r : h_vld;
+assign prod_ch_w = dp_cntrl_out.ch;
+
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: prod_p_GEN
+
+for (genvar n = 0; n < conv_pkg::KERNEL_DIAMETER_N; n++) begin: prod_n_GEN
+
+assign prod_w[p][n] = $signed(h_dat[p][n]) * $signed(coeff_h_r[n]);
+
+end: prod_n_GEN
+
+end: prod_p_GEN
+
+// ------------------------------------------------------------------------- //
+// Stage 2: Accumulate
+
+assign acc_en = prod_vld_r & (~stall_i);
+assign acc_vld_w = stall_i ? acc_vld_r : prod_vld_r;
+assign acc_ch_w = prod_ch_r;
+
+// Round-half-up constant; half of the LSB retained after normalization.
+assign acc_rnd = (shift_i == '0) ? '0 : (acc_t'(1) << (shift_i - 1'b1));
+
+always_comb begin: acc_PROC
+
+  for (int p = 0; p < conv_pkg::PPC; p++) begin
+    acc_w[p] = acc_rnd;
+    for (int n = 0; n < conv_pkg::KERNEL_DIAMETER_N; n++) begin
+      acc_w[p] = acc_w[p] + acc_t'($signed(prod_r[p][n]));
+    end
+  end
+
+end: acc_PROC
+
+// ------------------------------------------------------------------------- //
+// Output: Shift and saturate.
+
+for (genvar p = 0; p < conv_pkg::PPC; p++) begin: sat_GEN
+
+assign acc_shifted[p] = $signed(acc_r[p]) >>> shift_i;
+
+assign dat[p] =
+    acc_shifted[p][ACC_W - 1]
+  ? '0
+  : ((acc_shifted[p] > acc_t'({conv_pkg::PIXEL_W{1'b1}}))
+     ? '1
+     : acc_shifted[p][conv_pkg::PIXEL_W - 1:0]);
+
+end: sat_GEN
+
+// ========================================================================= //
+//                                                                           //
+// Outputs                                                                   //
+//                                                                           //
+// ========================================================================= //
+
+assign vld_o = acc_vld_r;
+assign dat_o = dat;
+assign ch_o = acc_ch_r;
+
+endmodule : conv_sep
+
+`define FLOPS_UNDEF
+`include "flops.svh"
+`undef FLOPS_UNDEF
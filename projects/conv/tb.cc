@@ -28,21 +28,84 @@
 #include "tb/tb.h"
 
 #include <algorithm>
-#include <deque>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <optional>
-
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tb/alloc.h"
+#include "tb/args.h"
+#include "tb/axis.h"
+#include "tb/axis_vip.h"
+#include "tb/coverage.h"
+#include "tb/mem.h"
 #include "tb/project.h"
+#include "tb/ring_buffer.h"
+#include "tb/signature.h"
+#include "tb/spsc_queue.h"
+#include "tb/traffic.h"
 #include "tb/vsupport.h"
 
-// instances
-#include "v/Vtb_asic_zeropad.h"
+#include "conv_coverage.h"
+
+// instances outside the configuration matrix
+#include "v/Vtb_asic_zeropad_ch3.h"
+#include "v/Vtb_asic_zeropad_k3.h"
+#include "v/Vtb_asic_zeropad_k7.h"
+#include "v/Vtb_asic_zeropad_k7_sep.h"
+
+// instance configurations (rendered from the instance defines)
+#include "cfg/tb_asic_zeropad_ch3.h"
+#include "cfg/tb_asic_zeropad_k3.h"
+#include "cfg/tb_asic_zeropad_k7.h"
+#include "cfg/tb_asic_zeropad_k7_sep.h"
+
+// instances of the configuration matrix, with their configurations
+// (rendered by generate_project)
+#include "matrix/conv.h"
 
 namespace {
 
+using projects::conv::ConvCoverage;
+using projects::conv::LbSkidState;
+
+// Package constants are common to all instances (see rtl/conv.yaml), and
+// are taken from the configuration of the default instance; each instance
+// is checked against them at compile time (see ConvTestbench).
+using PkgCfg = cfg::tb_conv_asic_zeropad_kernel_full_ppc1;
+
+// Pixel width in bits (see conv_pkg::PIXEL_W).
+constexpr std::size_t PIXEL_W = PkgCfg::PIXEL_W;
+
+// Pixels per ASIC line buffer SRAM word (see conv_pkg::LB_ASIC_SRAM_W).
+constexpr std::size_t LB_ASIC_PIXELS_PER_WORD_N =
+  PkgCfg::LB_ASIC_SRAM_W / PIXEL_W;
+
+// Maximum pixels per clock (see conv_pkg::PPC_MAX).
+constexpr std::size_t PPC_MAX = PkgCfg::PPC_MAX;
+
+// Maximum image width (see conv_pkg::IMAGE_MAX_W).
+constexpr std::size_t IMAGE_MAX_W = PkgCfg::IMAGE_MAX_W;
+
+// Maximum normalization shift of the filter stage (see conv_pkg::MAC_SHIFT_W).
+constexpr unsigned MAC_SHIFT_MAX = (1u << PkgCfg::MAC_SHIFT_W) - 1;
+
+// Frames outstanding at the output of a channel (presented, yet not wholly
+// emitted); bounds the state retained per frame. The final kernels of a
+// frame are flushed only by the lines of its successor.
+constexpr std::size_t OUTSTANDING_FRAMES_MAX = 8;
+
 // Forwards:
 template <typename T>
 class FrameGenerator;
@@ -72,6 +135,150 @@ void Kernel<T, N>::os(std::ostream& os) const {
   }
 }
 
+// Filter coefficients (see conv_pkg::coeff_kernel_t); coefficient [j][i] is
+// applied to kernel pixel [j][i]. Retained at sufficient precision for the
+// 2D equivalent of separable taps; coefficients loaded into the 2D filter
+// must lie within the range of conv_pkg::coeff_t.
+template <std::size_t N>
+struct Coefficients {
+  std::int16_t data[N][N];
+
+  // Normalization (right) shift applied to the accumulated result.
+  unsigned shift;
+};
+
+// Binomial coefficients of order (N - 1); the taps of a 1D gaussian.
+template <std::size_t N>
+std::array<int, N> binomial() noexcept {
+  std::array<int, N> b{};
+  b[0] = 1;
+  for (std::size_t k = 1; k < N; ++k) {
+    for (std::size_t i = k; i > 0; --i) {
+      b[i] += b[i - 1];
+    }
+  }
+  return b;
+}
+
+// Construct a named coefficient set: identity, box, gaussian, sharpen, sobel
+// or random.
+template <std::size_t N>
+Coefficients<N> make_coefficients(const std::string& name) {
+  constexpr std::size_t c = N / 2;
+  Coefficients<N> cs{};
+  if (name == "identity") {
+    cs.data[c][c] = 1;
+  } else if (name == "box") {
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < N; ++i) {
+        cs.data[j][i] = 1;
+      }
+    }
+    cs.shift = std::bit_width(N * N) - 1;
+  } else if (name == "gaussian") {
+    // Outer product of binomial coefficients.
+    const std::array<int, N> b = binomial<N>();
+    if ((b[c] * b[c]) > INT8_MAX) {
+      throw std::runtime_error("Gaussian coefficients exceed range");
+    }
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < N; ++i) {
+        cs.data[j][i] = static_cast<std::int8_t>(b[j] * b[i]);
+      }
+    }
+    cs.shift = 2 * (N - 1);
+  } else if (name == "sharpen") {
+    cs.data[c][c] = 5;
+    cs.data[c - 1][c] = cs.data[c + 1][c] = -1;
+    cs.data[c][c - 1] = cs.data[c][c + 1] = -1;
+  } else if (name == "sobel") {
+    for (std::size_t j = c - 1; j <= c + 1; ++j) {
+      const std::int8_t w = (j == c) ? 2 : 1;
+      cs.data[j][c - 1] = -w;
+      cs.data[j][c + 1] = w;
+    }
+  } else if (name == "random") {
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < N; ++i) {
+        cs.data[j][i] =
+          static_cast<std::int8_t>(tb::RANDOM.uniform<int>(INT8_MAX, INT8_MIN));
+      }
+    }
+    cs.shift = tb::RANDOM.uniform<unsigned>(MAC_SHIFT_MAX, 0);
+  } else {
+    throw std::runtime_error("Unknown coefficient set: " + name);
+  }
+  return cs;
+}
+
+// Separable filter taps (see conv_pkg::coeff_span_t); the equivalent 2D
+// coefficient [j][i] is v[j] * h[i].
+template <std::size_t N>
+struct SeparableCoefficients {
+  // Vertical taps; tap [j] is applied to kernel row j.
+  std::int8_t v[N];
+
+  // Horizontal taps; tap [i] is applied to kernel column i.
+  std::int8_t h[N];
+
+  // Normalization (right) shift applied to the accumulated result.
+  unsigned shift;
+
+  // Equivalent 2D coefficients.
+  Coefficients<N> outer() const noexcept {
+    Coefficients<N> cs{};
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < N; ++i) {
+        cs.data[j][i] = static_cast<std::int16_t>(v[j] * h[i]);
+      }
+    }
+    cs.shift = shift;
+    return cs;
+  }
+};
+
+// Construct a named separable tap set: identity, box, gaussian, sobel or
+// random. Each is equivalent to the like-named set of make_coefficients
+// (random taps are drawn such that all 2D products remain within the range
+// of conv_pkg::coeff_t).
+template <std::size_t N>
+SeparableCoefficients<N> make_separable_coefficients(const std::string& name) {
+  constexpr std::size_t c = N / 2;
+  SeparableCoefficients<N> cs{};
+  if (name == "identity") {
+    cs.v[c] = cs.h[c] = 1;
+  } else if (name == "box") {
+    for (std::size_t k = 0; k < N; ++k) {
+      cs.v[k] = cs.h[k] = 1;
+    }
+    cs.shift = std::bit_width(N * N) - 1;
+  } else if (name == "gaussian") {
+    const std::array<int, N> b = binomial<N>();
+    for (std::size_t k = 0; k < N; ++k) {
+      cs.v[k] = cs.h[k] = static_cast<std::int8_t>(b[k]);
+    }
+    cs.shift = 2 * (N - 1);
+  } else if (name == "sobel") {
+    cs.v[c - 1] = cs.v[c + 1] = 1;
+    cs.v[c] = 2;
+    cs.h[c - 1] = -1;
+    cs.h[c + 1] = 1;
+  } else if (name == "random") {
+    // |v * h| <= TAP_MAX^2 <= INT8_MAX
+    constexpr int TAP_MAX = 11;
+    for (std::size_t k = 0; k < N; ++k) {
+      cs.v[k] = static_cast<std::int8_t>(
+        tb::RANDOM.uniform<int>(TAP_MAX, -TAP_MAX));
+      cs.h[k] = static_cast<std::int8_t>(
+        tb::RANDOM.uniform<int>(TAP_MAX, -TAP_MAX));
+    }
+    cs.shift = tb::RANDOM.uniform<unsigned>(MAC_SHIFT_MAX, 0);
+  } else {
+    throw std::runtime_error("Unknown separable coefficient set: " + name);
+  }
+  return cs;
+}
+
 template <typename T, std::size_t N>
 bool equal(const Kernel<T, N>& lhs, const Kernel<T, N>& rhs) {
   for (std::size_t j = 0; j < lhs.size(); ++j) {
@@ -88,14 +295,16 @@ template <typename T>
 struct SlaveInterfaceIn {
   explicit SlaveInterfaceIn() {
     tvalid = false;
-    tdata = T{0};
+    tdata.fill(T{0});
     tlast = false;
     tuser = false;
+    tid = 0;
   }
   bool tvalid;
-  T tdata;
+  std::array<T, PPC_MAX> tdata;  // Pixel group; lane 0 is west-most.
   bool tlast;  // End-Of-Line (EOL)
   bool tuser;  // Start-Of-Frame (SOF)
+  std::size_t tid;  // Channel ID
 };
 
 struct SlaveInterfaceOut {
@@ -105,7 +314,19 @@ struct SlaveInterfaceOut {
 template <typename T, std::size_t N>
 struct MasterInterfaceOut {
   bool m_tvalid;
-  Kernel<T, N> m_tdata;
+  std::array<Kernel<T, N>, PPC_MAX> m_tdata;  // Kernel per lane (KERNEL).
+  std::array<T, PPC_MAX> m_tpixel;  // Filtered pixel per lane (FILTER).
+  std::size_t m_tid;  // Channel ID
+};
+
+// Coefficient load interface (FILTER output mode).
+struct CoeffLoadIn {
+  explicit CoeffLoadIn(unsigned shift = 0) : shift(shift) {}
+
+  bool vld{false};
+  std::size_t idx{0};
+  std::int8_t dat{0};
+  unsigned shift;
 };
 
 struct MasterInterfaceIn {
@@ -130,6 +351,9 @@ class Frame {
   }
 
  public:
+  // Empty frame; storage to which frames are later assigned.
+  explicit Frame() : width_(0), height_(0) {}
+
   std::size_t width() const noexcept { return width_; }
   std::size_t height() const noexcept { return height_; }
 
@@ -242,7 +466,51 @@ class ConvolutionEngine {
     }
   }
 
+  // Kernel at position (y, x) of the frame.
+  Kernel<T, N> kernel(std::size_t y, std::size_t x) const {
+    return compute_kernel(y, x);
+  }
+
+  // Bit-exact reference of the filter stage (see conv_mac): the kernel is
+  // convolved with the coefficients, normalized by a right shift with
+  // round-half-up, and saturated to the pixel range.
+  static T filter(const Kernel<T, N>& k, const Coefficients<N>& cs) noexcept {
+    std::int64_t acc = 0;
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < N; ++i) {
+        acc += static_cast<std::int64_t>(k.data[j][i]) * cs.data[j][i];
+      }
+    }
+    return normalize(acc, cs.shift);
+  }
+
+  // Bit-exact reference of the separable filter (see conv_sep): each column
+  // of the kernel is reduced by the vertical taps, the column results by the
+  // horizontal taps. Normalized as filter().
+  static T filter_separable(
+    const Kernel<T, N>& k, const SeparableCoefficients<N>& cs) noexcept {
+    std::int64_t acc = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      std::int64_t v = 0;
+      for (std::size_t j = 0; j < N; ++j) {
+        v += static_cast<std::int64_t>(k.data[j][i]) * cs.v[j];
+      }
+      acc += v * cs.h[i];
+    }
+    return normalize(acc, cs.shift);
+  }
+
  private:
+  // Right shift with round-half-up, saturated to the pixel range.
+  static T normalize(std::int64_t acc, unsigned shift) noexcept {
+    if (shift != 0) {
+      acc += (std::int64_t{1} << (shift - 1));
+    }
+    acc >>= shift;
+    return static_cast<T>(std::clamp<std::int64_t>(
+      acc, 0, std::numeric_limits<T>::max()));
+  }
+
   Kernel<T, N> compute_kernel(std::size_t y, std::size_t x) const {
     Kernel<T, N> kernel{};
     for (std::size_t j = 0; j < N; ++j) {
@@ -289,21 +557,40 @@ concept VConvModule = requires(T t) {
   t.s_tdata_i;
   t.s_tlast_i;
   t.s_tuser_i;
+  t.s_tid_i;
   t.s_tready_o;
 
   // Master interface ports
   t.m_tready_i;
   t.m_tvalid_o;
+  t.m_tid_o;
+
+  // Coefficient load ports
+  t.coeff_vld_i;
+  t.coeff_idx_i;
+  t.coeff_dat_i;
+  t.coeff_shift_i;
+
+  // Coverage ports
+  t.tb_lb_skid_vld_o;
+  t.tb_lb_skid_idx_o;
 
   // Module parameterizations
   t.cfg_target_o;
   t.cfg_extend_strategy_o;
+  t.cfg_ppc_o;
+  t.cfg_kernel_diameter_o;
+  t.cfg_channel_n_o;
+  t.cfg_output_mode_o;
+  t.cfg_filter_impl_o;
 
   // Generic synchronous ports
   t.clk;
   t.arst_n;
 };
 
+// Testbench interface of an instance with kernel diameter N.
+template <std::size_t N>
 struct ConvTestbenchInterface {
   virtual ~ConvTestbenchInterface() = default;
 
@@ -312,96 +599,748 @@ struct ConvTestbenchInterface {
   virtual void s_in(const SlaveInterfaceIn<vluint8_t>& in) noexcept = 0;
   virtual SlaveInterfaceOut s_out() const noexcept = 0;
 
+  // Slave beat driver (see tb::axis::BeatDriver); beats are queued ahead
+  // of time and presented, when active, once READY has settled.
+  virtual bool s_push(const SlaveInterfaceIn<vluint8_t>& in) noexcept = 0;
+  virtual bool s_empty() const noexcept = 0;
+  virtual bool s_full() const noexcept = 0;
+  virtual const SlaveInterfaceIn<vluint8_t>* s_drive(bool active) noexcept = 0;
+
   virtual void m_idle() noexcept { m_in(MasterInterfaceIn{}); }
   virtual MasterInterfaceIn m_in() const noexcept = 0;
   virtual void m_in(const MasterInterfaceIn& in) noexcept = 0;
-  virtual MasterInterfaceOut<vluint8_t, 5> m_out() const noexcept = 0;
+  virtual MasterInterfaceOut<vluint8_t, N> m_out() const noexcept = 0;
+
+  // Master beat monitor (see tb::axis::BeatMonitor); returns the beat
+  // transferred at the upcoming edge, if any.
+  virtual const MasterInterfaceOut<vluint8_t, N>* m_sample() noexcept = 0;
+
+  virtual LbSkidState<N> lb_skid() const noexcept = 0;
+  virtual std::string cfg_target() const = 0;
+
+  // Kernel diameter of the elaborated RTL; must equal N.
+  virtual std::size_t cfg_kernel_diameter() const = 0;
+
+  // Pixels per clock; pixels per Slave beat and kernels per Master beat.
+  virtual std::size_t cfg_ppc() const = 0;
+
+  // Interleaved channels; beats rotate across channels, by ID (TID).
+  virtual std::size_t cfg_channel_n() const = 0;
+
+  // Output mode: "KERNEL" or "FILTER" (see cfg_pkg::OUTPUT_MODE).
+  virtual std::string cfg_output_mode() const = 0;
+
+  // Filter implementation: "FULL" or "SEPARABLE" (see cfg_pkg::FILTER_IMPL).
+  virtual std::string cfg_filter_impl() const = 0;
+
+  virtual void coeff_in(const CoeffLoadIn& in) noexcept = 0;
+
+  // Slave (ingress) to Master (egress) stream performance monitor.
+  virtual tb::axis::PathMonitor* stream_monitor() noexcept = 0;
+
+  // Failure of the test; retains diagnostics (see tb::ProjectInstanceBase).
+  virtual void on_failure() = 0;
 
   virtual void eval() = 0;
   virtual std::size_t cycle() = 0;
 };
 
+// Streams the frames of one or more channels; channels are interleaved
+// beat-by-beat in strict rotation, each framed by its own SOF and EOL.
 class FrameTransactor {
  public:
   explicit FrameTransactor() { init(); }
   virtual ~FrameTransactor() = default;
 
-  void init(Frame<vluint8_t>* next_frame = nullptr) noexcept {
+  // Frames (one per channel) must be of equal dimension, and their width a
+  // multiple of the pixels per clock (ppc).
+  void init(std::vector<Frame<vluint8_t>>* next_frames = nullptr,
+    std::size_t ppc = 1) noexcept {
     pixel_x_ = 0;
     pixel_y_ = 0;
-    frame_ = next_frame;
+    ch_ = 0;
+    ppc_ = ppc;
+    frames_ = next_frames;
   }
 
-  bool frame_exhausted() const noexcept { return !frame_; }
+  bool frame_exhausted() const noexcept { return !frames_; }
 
   SlaveInterfaceIn<vluint8_t> next() {
+    const Frame<vluint8_t>& frame = (*frames_)[ch_];
     SlaveInterfaceIn<vluint8_t> in{};
     in.tvalid = true;
-    in.tdata = frame_->get_pixel(pixel_y_, pixel_x_);
-    in.tlast = (pixel_x_ == (frame_->width() - 1));
+    for (std::size_t i = 0; i < ppc_; ++i) {
+      in.tdata[i] = frame.get_pixel(pixel_y_, pixel_x_ + i);
+    }
+    in.tlast = is_col_last();
     in.tuser = ((pixel_x_ == 0) && (pixel_y_ == 0));
+    in.tid = ch_;
     return in;
   }
 
   void advance() noexcept {
-    const bool is_col_last = (pixel_x_ == (frame_->width() - 1));
-    const bool is_line_last = (pixel_y_ == (frame_->height() - 1));
+    // Advance position once all channels have been presented.
+    if (++ch_ < frames_->size()) {
+      return;
+    }
+    ch_ = 0;
 
-    if (is_col_last && !is_line_last) {
+    const bool is_line_last = (pixel_y_ == (frames_->front().height() - 1));
+
+    if (is_col_last() && !is_line_last) {
       // End of line, advance to next row.
       ++pixel_y_;
       pixel_x_ = 0;
-    } else if (is_col_last && is_line_last) {
+    } else if (is_col_last() && is_line_last) {
       // Final pixel has been consumed.
-      frame_ = nullptr;
+      frames_ = nullptr;
     } else {
-      // Otherwise, advance to next pixel in current line.
-      pixel_x_++;
+      // Otherwise, advance to next pixel group in current line.
+      pixel_x_ += ppc_;
     }
   }
 
+ private:
+  bool is_col_last() const noexcept {
+    return ((pixel_x_ + ppc_) >= frames_->front().width());
+  }
+
   std::size_t pixel_y_{0};
   std::size_t pixel_x_{0};
-  Frame<vluint8_t>* frame_{nullptr};
+  std::size_t ch_{0};
+  std::size_t ppc_{1};
+  std::vector<Frame<vluint8_t>>* frames_{nullptr};
+};
+
+// Tracks the frame position of kernels emitted on the Master interface.
+class KernelPositionTracker {
+ public:
+  explicit KernelPositionTracker() : frames_(OUTSTANDING_FRAMES_MAX) {}
+
+  void push_frame(std::size_t width, std::size_t height) {
+    if (!frames_.push_back(std::make_pair(width, height))) {
+      throw std::runtime_error("Outstanding frames exceed capacity");
+    }
+  }
+
+  bool empty() const noexcept { return frames_.empty(); }
+
+  std::size_t y() const noexcept { return y_; }
+  std::size_t x() const noexcept { return x_; }
+  std::size_t width() const noexcept { return frames_.front().first; }
+  std::size_t height() const noexcept { return frames_.front().second; }
+
+  void advance() noexcept {
+    if (++x_ < width()) {
+      return;
+    }
+    x_ = 0;
+    if (++y_ < height()) {
+      return;
+    }
+    // Frame complete.
+    y_ = 0;
+    frames_.pop_front();
+  }
+
+ private:
+  std::size_t y_{0};
+  std::size_t x_{0};
+
+  // Dimensions (width, height) of outstanding frames.
+  tb::RingBuffer<std::pair<std::size_t, std::size_t>> frames_;
+};
+
+// Signature-based checker of the output stream of a channel. Expected and
+// actual elements (kernels, or filtered pixels in FILTER mode) are folded
+// into CRC-64 signatures per window, per frame and per run; only the input
+// frames outstanding at the output are retained, such that memory is
+// independent of the length of the run. Windows are compared as they close,
+// and frames at their boundary. On mismatch of a window, its elements are
+// regenerated from the input frame and compared element-wise to localize
+// the mismatch.
+template <std::size_t N>
+class SignatureChecker {
+  using Engine = ConvolutionEngine<vluint8_t, N>;
+
+ public:
+  // Elements per window.
+  static constexpr std::size_t WINDOW_N = 256;
+
+  // Element-wise mismatches reported per window.
+  static constexpr std::size_t WINDOW_REPORT_N = 4;
+
+  explicit SignatureChecker(
+    std::size_t ch, std::optional<Coefficients<N>> coeffs = std::nullopt)
+      : ch_(ch),
+        coeffs_(std::move(coeffs)),
+        element_bytes_(coeffs_ ? 1 : (N * N)),
+        pending_(OUTSTANDING_FRAMES_MAX),
+        window_(WINDOW_N * element_bytes_) {}
+
+  // Expect the output of frame. Pending entries are populated in place,
+  // reusing the storage of those retired.
+  void push_frame(const Frame<vluint8_t>& frame) {
+    if (pending_.full()) {
+      throw std::runtime_error("Outstanding frames exceed capacity");
+    }
+    Pending& p = pending_.back_slot();
+    p.frame = frame;
+    p.windows.clear();
+    const Engine ceng{p.frame};
+    tb::Crc64 frame_crc;
+    tb::Crc64 window_crc;
+    std::uint8_t e[N * N];
+    const std::size_t n = frame.width() * frame.height();
+    for (std::size_t i = 0; i < n; ++i) {
+      serialize(ceng.kernel(i / frame.width(), i % frame.width()), e);
+      frame_crc.update(e, element_bytes_);
+      window_crc.update(e, element_bytes_);
+      if ((((i + 1) % WINDOW_N) == 0) || ((i + 1) == n)) {
+        p.windows.push_back(window_crc.value());
+        window_crc.reset();
+      }
+    }
+    p.signature = frame_crc.value();
+    pending_.push_back();
+  }
+
+  // Observe actual element (of element_bytes()); returns false if no output
+  // was expected, in which case the element is counted as unexpected.
+  bool observe(const std::uint8_t* a, std::size_t cycle) {
+    if (pending_.empty()) {
+      std::cout << "Received unexpected output (channel " << std::dec << ch_
+                << ")\n";
+      ++unexpected_n_;
+      return false;
+    }
+
+    frame_crc_.update(a, element_bytes_);
+    window_crc_.update(a, element_bytes_);
+    std::memcpy(
+      &window_[(i_ % WINDOW_N) * element_bytes_], a, element_bytes_);
+
+    const Pending& p = pending_.front();
+    const std::size_t n = p.frame.width() * p.frame.height();
+    if ((((i_ + 1) % WINDOW_N) == 0) || ((i_ + 1) == n)) {
+      close_window(cycle);
+    }
+    if (++i_ == n) {
+      close_frame(cycle);
+    }
+    return true;
+  }
+
+  std::size_t element_bytes() const noexcept { return element_bytes_; }
+
+  std::size_t frames_n() const noexcept { return frames_n_; }
+  std::size_t mismatched_frames_n() const noexcept {
+    return mismatched_frames_n_;
+  }
+
+  // Elements received when no output was expected.
+  std::size_t unexpected_n() const noexcept { return unexpected_n_; }
+
+  // Windows found mismatched (and localized), over all frames.
+  std::size_t mismatched_windows_n() const noexcept {
+    return mismatched_windows_n_;
+  }
+
+  void report(std::ostream& os) const {
+    os << "Signature (channel " << std::dec << ch_ << "): " << frames_n_
+       << " frames, " << mismatched_frames_n_ << " mismatched, "
+       << unexpected_n_ << " unexpected; run expected "
+       << std::hex << std::setw(16) << std::setfill('0')
+       << run_expected_.value() << " actual " << std::setw(16)
+       << run_actual_.value()
+       << std::setfill(' ') << std::dec << "\n";
+  }
+
+ private:
+  struct Pending {
+    Frame<vluint8_t> frame;
+    std::vector<std::uint64_t> windows;
+    std::uint64_t signature{0};
+  };
+
+  // Serialized element: the kernel, or the filtered pixel.
+  void serialize(const Kernel<vluint8_t, N>& k, std::uint8_t* out) const {
+    if (coeffs_) {
+      out[0] = Engine::filter(k, *coeffs_);
+    } else {
+      std::memcpy(out, &k.data[0][0], N * N);
+    }
+  }
+
+  void close_window(std::size_t cycle) {
+    const Pending& p = pending_.front();
+    const std::size_t w = i_ / WINDOW_N;
+    if (window_crc_.value() != p.windows[w]) {
+      ++mismatched_windows_n_;
+      localize(w, cycle);
+    }
+    window_crc_.reset();
+  }
+
+  // Compare the elements of window w against their regenerated expectation.
+  void localize(std::size_t w, std::size_t cycle) {
+    const Pending& p = pending_.front();
+    const Engine ceng{p.frame};
+    std::cout << "Signature mismatch detected " << std::dec << cycle
+              << ": channel " << ch_ << " frame " << frames_n_ << " window "
+              << w << "\n";
+
+    std::uint8_t e[N * N];
+    std::size_t reported_n = 0;
+    for (std::size_t i = w * WINDOW_N; i <= i_; ++i) {
+      const std::size_t y = i / p.frame.width();
+      const std::size_t x = i % p.frame.width();
+      serialize(ceng.kernel(y, x), e);
+      const std::uint8_t* a = &window_[(i % WINDOW_N) * element_bytes_];
+      if (std::memcmp(a, e, element_bytes_) == 0) {
+        continue;
+      }
+      if (reported_n++ == WINDOW_REPORT_N) {
+        break;
+      }
+      std::cout << "Mismatch at (" << y << ", " << x << ") Received:";
+      for (std::size_t b = 0; b < element_bytes_; ++b) {
+        std::cout << ' ' << std::hex << static_cast<uint32_t>(a[b]);
+      }
+      std::cout << " Expected:";
+      for (std::size_t b = 0; b < element_bytes_; ++b) {
+        std::cout << ' ' << std::hex << static_cast<uint32_t>(e[b]);
+      }
+      std::cout << std::dec << "\n";
+    }
+  }
+
+  void close_frame(std::size_t cycle) {
+    const Pending& p = pending_.front();
+    const std::uint64_t actual = frame_crc_.value();
+    const bool is_match = (actual == p.signature);
+    std::cout << "Frame signature " << (is_match ? "match " : "mismatch ")
+              << std::dec << cycle << ": channel " << ch_ << " frame "
+              << frames_n_ << " " << std::hex << std::setw(16)
+              << std::setfill('0') << actual << std::setfill(' ') << std::dec
+              << "\n";
+    if (!is_match) {
+      ++mismatched_frames_n_;
+    }
+
+    run_expected_.update(p.signature);
+    run_actual_.update(actual);
+    ++frames_n_;
+
+    frame_crc_.reset();
+    i_ = 0;
+    pending_.pop_front();
+  }
+
+  std::size_t ch_;
+  std::optional<Coefficients<N>> coeffs_;
+  std::size_t element_bytes_;
+
+  // Input frames outstanding at the output, and their expected signatures.
+  tb::RingBuffer<Pending> pending_;
+
+  // Index of the next element of the frame at the head of pending_, and the
+  // elements of the current window.
+  std::size_t i_{0};
+  std::vector<std::uint8_t> window_;
+
+  tb::Crc64 frame_crc_;
+  tb::Crc64 window_crc_;
+  tb::Crc64 run_expected_;
+  tb::Crc64 run_actual_;
+
+  std::size_t frames_n_{0};
+  std::size_t mismatched_frames_n_{0};
+  std::size_t mismatched_windows_n_{0};
+  std::size_t unexpected_n_{0};
+};
+
+// Golden model, run on a worker thread ahead of the simulation. Frames are
+// posted as they are presented to the UUT; their expected kernels are
+// returned through a bounded lock-free queue, in the order emitted by the
+// UUT (beat by beat, channels in rotation), such that the cost of the
+// reference model overlaps with evaluation of the UUT.
+template <std::size_t N>
+class GoldenModel {
+ public:
+  using frames_type = std::shared_ptr<const std::vector<Frame<vluint8_t>>>;
+
+  struct Expected {
+    std::size_t ch;
+    Kernel<vluint8_t, N> kernel;
+  };
+
+  // Capacity of the expected kernel queue; the extent to which the model
+  // may run ahead.
+  static constexpr std::size_t EXPECTED_N = 4096;
+
+  // Capacity of the frame queue.
+  static constexpr std::size_t FRAMES_N = 16;
+
+  // Kernels are emitted in groups of ppc per beat.
+  explicit GoldenModel(std::size_t ppc)
+      : ppc_(ppc),
+        frames_(FRAMES_N),
+        expected_(EXPECTED_N),
+        worker_([this] { run(); }) {}
+
+  ~GoldenModel() {
+    stop_.store(true);
+    // Wake the worker if idle; a full queue implies it is not.
+    frames_type none;
+    frames_.try_push(none);
+    worker_.join();
+  }
+
+  // Post the frames (one per channel) presented to the UUT; their kernels
+  // are returned interleaved, as their beats are emitted by the UUT.
+  void post(frames_type frames) { frames_.push(std::move(frames)); }
+
+  // Blocks until an expected kernel is available.
+  void take(Expected& e) { expected_.pop(e); }
+
+ private:
+  void run() {
+    while (!stop_.load()) {
+      frames_type frames;
+      frames_.pop(frames);
+      if (!frames) {
+        continue;
+      }
+      // Frames of all channels are of equal dimension.
+      const std::size_t w = frames->front().width();
+      const std::size_t h = frames->front().height();
+      for (std::size_t y = 0; y < h; ++y) {
+        for (std::size_t x = 0; x < w; x += ppc_) {
+          for (std::size_t ch = 0; ch < frames->size(); ++ch) {
+            const ConvolutionEngine<vluint8_t, N> ceng{(*frames)[ch]};
+            for (std::size_t p = 0; p < ppc_; ++p) {
+              Expected e{ch, ceng.kernel(y, x + p)};
+              while (!expected_.try_push(e)) {
+                if (stop_.load()) {
+                  return;
+                }
+                std::this_thread::yield();
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::size_t ppc_;
+  tb::SpscQueue<frames_type> frames_;
+  tb::SpscQueue<Expected> expected_;
+  std::atomic<bool> stop_{false};
+  std::thread worker_;
+};
+
+// Backdoor to the line buffers (lb_GEN[i]) of an instance whose memories are
+// backed by the testbench (TB_CFG__MEM_MODEL: DPI). A line is addressed by
+// beat (pixel group) in the order presented at the input, channels
+// interleaved. ASIC banks pack LB_ASIC_PIXELS_PER_WORD_N pixels per SRAM
+// word, first beat least-significant; FPGA banks hold a beat per word.
+class LineBufferBackdoor {
+ public:
+  explicit LineBufferBackdoor(std::size_t banks_n, std::size_t ppc,
+    bool is_asic)
+      : ppc_(ppc),
+        groups_per_word_n_(is_asic ? (LB_ASIC_PIXELS_PER_WORD_N / ppc) : 1) {
+    for (std::size_t i = 0; i < banks_n; ++i) {
+      const std::string fragment = ".lb_GEN[" + std::to_string(i) + "].";
+      tb::mem::Memory* m = tb::mem::MEMORY_REGISTRY.lookup(fragment);
+      if (!m) {
+        throw std::runtime_error("Line buffer memory not found: " + fragment +
+          " (requires TB_CFG__MEM_MODEL: DPI)");
+      }
+      banks_.push_back(m);
+    }
+  }
+
+  std::size_t banks_n() const noexcept { return banks_.size(); }
+
+  // Pixel p of beat k of bank b.
+  vluint8_t peek(std::size_t b, std::size_t k, std::size_t p) const {
+    return static_cast<vluint8_t>(
+      banks_[b]->peek(word(k), lsb(k, p), PIXEL_W));
+  }
+
+  void poke(std::size_t b, std::size_t k, std::size_t p, vluint8_t v) {
+    banks_[b]->poke(word(k), lsb(k, p), PIXEL_W, v);
+  }
+
+  // Preload bank b with line y of the frames (one per channel).
+  void preload(std::size_t b, const std::vector<Frame<vluint8_t>>& frames,
+    std::size_t y) {
+    for_each_pixel(frames, y, [&](std::size_t k, std::size_t p, vluint8_t v) {
+      poke(b, k, p, v);
+    });
+  }
+
+  // Pixels of bank b that differ from line y of the frames.
+  std::size_t compare(std::size_t b,
+    const std::vector<Frame<vluint8_t>>& frames, std::size_t y) const {
+    std::size_t mismatches_n = 0;
+    for_each_pixel(frames, y, [&](std::size_t k, std::size_t p, vluint8_t v) {
+      if (peek(b, k, p) != v) {
+        ++mismatches_n;
+      }
+    });
+    return mismatches_n;
+  }
+
+ private:
+  std::size_t word(std::size_t k) const noexcept {
+    return k / groups_per_word_n_;
+  }
+
+  std::size_t lsb(std::size_t k, std::size_t p) const noexcept {
+    return ((k % groups_per_word_n_) * ppc_ + p) * PIXEL_W;
+  }
+
+  template <typename Fn>
+  void for_each_pixel(const std::vector<Frame<vluint8_t>>& frames,
+    std::size_t y, Fn&& fn) const {
+    const std::size_t channel_n = frames.size();
+    for (std::size_t x = 0; x < frames.front().width(); x += ppc_) {
+      for (std::size_t ch = 0; ch < channel_n; ++ch) {
+        for (std::size_t p = 0; p < ppc_; ++p) {
+          fn((x / ppc_) * channel_n + ch, p, frames[ch].get_pixel(y, x + p));
+        }
+      }
+    }
+  }
+
+  std::size_t ppc_;
+  std::size_t groups_per_word_n_;
+  std::vector<tb::mem::Memory*> banks_;
 };
 
-class ConvTestDriver : public tb::GenericSynchronousTest {
+// Base class of conv tests; exposes the test hooks to the dispatcher
+// (ConvTest) of a test to its specialization for the kernel diameter of
+// an instance.
+class ConvTestDriverBase : public tb::GenericSynchronousTest {
+ public:
+  using tb::GenericSynchronousTest::is_complete;
+  using tb::GenericSynchronousTest::max_cycles_n;
+  using tb::GenericSynchronousTest::on_negedge;
+  using tb::GenericSynchronousTest::requires_completion;
+
+ protected:
+  explicit ConvTestDriverBase(const std::string& args)
+      : tb::GenericSynchronousTest(args) {}
+};
+
+// Base class of conv tests, specialized for kernel diameter N. Arguments
+// common to all tests:
+//
+//   seed=<n>            Randomization seed.
+//   cov_load=<fn>       Seed coverage from database.
+//   cov_save=<fn>       Save coverage to database on completion.
+//   min_throughput=<r>  Output must sustain r kernels/cycle whenever it is
+//                       neither back-pressured nor starved of input.
+//   coeff=<set>         Filter coefficients (FILTER instances only); one of
+//                       identity, box, gaussian (default), sharpen, sobel or
+//                       random. Separable instances (and tests) are
+//                       restricted to the separable sets: identity, box,
+//                       gaussian, sobel or random.
+//   s_traffic=<spec>    Input (TVALID) traffic profile (see tb/traffic.h);
+//                       default: full.
+//   m_traffic=<spec>    Output (TREADY) traffic profile; default:
+//                       bernoulli:0.7.
+//   check=<mode>        Output checking: element (default), against each
+//                       expected kernel; or signature, against per-frame
+//                       signatures in constant memory (see
+//                       SignatureChecker), for long (soak) runs.
+//
+template <std::size_t N>
+class ConvTestDriver : public ConvTestDriverBase {
+  using Interface = ConvTestbenchInterface<N>;
+  using Scoreboard = tb::axis::Scoreboard<Kernel<vluint8_t, N>>;
+
   // Slave interface
   SlaveInterfaceIn<vluint8_t> s_in_;
-  SlaveInterfaceOut s_out_;
 
   // Master interface
   MasterInterfaceIn m_in_;
-  MasterInterfaceOut<vluint8_t, 5> m_out_;
 
  public:
   explicit ConvTestDriver(const std::string& args)
-      : tb::GenericSynchronousTest(args) {}
+      : ConvTestDriverBase(args), targs_(args) {
+    if (targs_.has("seed")) {
+      tb::RANDOM.seed(targs_.get_or<tb::Random::seed_type>("seed", 0));
+    }
+  }
 
   virtual ~ConvTestDriver() = default;
 
   void init(tb::ProjectInstanceBase* base) override {
-    ConvTestbenchInterface* intf = cast_interface(base);
+    Interface* intf = cast_interface(base);
 
     // Idle interfaces
     intf->m_idle();
     intf->s_idle();
+
+    // Construct coverage model; skid buffers are present only on ASIC
+    // line buffer implementations. Evaluate to settle parameterization
+    // outputs.
+    intf->eval();
+    if (intf->cfg_kernel_diameter() != N) {
+      throw std::runtime_error("Instance kernel diameter mismatch");
+    }
+    ppc_ = intf->cfg_ppc();
+    channel_n_ = intf->cfg_channel_n();
+    expected_pos_.assign(channel_n_, KernelPositionTracker{});
+    if (intf->cfg_output_mode() == "FILTER") {
+      init_coefficients(intf->cfg_filter_impl() == "SEPARABLE");
+    }
+    const std::string check = targs_.get("check").value_or("element");
+    if ((check != "element") && (check != "signature")) {
+      throw std::runtime_error("Unknown check mode: " + check);
+    }
+    expected_.clear();
+    signatures_.clear();
+    for (std::size_t ch = 0; ch < channel_n_; ++ch) {
+      if (check == "signature") {
+        signatures_.emplace_back(ch, coeffs_);
+      } else {
+        expected_.emplace_back(PPC_MAX);
+      }
+    }
+    outstanding_.assign(channel_n_, 0);
+    posted_kernels_n_ = {};
+    expected_ch_ = 0;
+    if (signatures_.empty()) {
+      golden_.emplace(ppc_);
+    }
+    coeff_idx_ = 0;
+    s_traffic_.emplace(tb::traffic::Profile::from_spec(
+      targs_.get("s_traffic").value_or(default_s_traffic())));
+    m_traffic_.emplace(tb::traffic::Profile::from_spec(
+      targs_.get("m_traffic").value_or(default_m_traffic())));
+    cov_.emplace(
+      intf->cfg_target() == "ASIC", LB_ASIC_PIXELS_PER_WORD_N / ppc_);
+    if (const std::optional<std::string> fn = targs_.get("cov_load")) {
+      // Seed with coverage accumulated by prior (or parallel) runs.
+      cov_->model().load(*fn);
+    }
+
+    // Throughput assertion (beats/cycle) applied to the output stream.
+    if (targs_.has("min_throughput")) {
+      intf->stream_monitor()->expect_throughput(
+        targs_.get_or<double>("min_throughput", 0.0));
+    }
   }
 
   void fini(tb::ProjectInstanceBase* base) override {
-    // Finalization code here.
+    Interface* intf = cast_interface(base);
+
+    cov_->model().report(std::cout);
+    if (const std::optional<std::string> fn = targs_.get("cov_save")) {
+      cov_->model().save(*fn);
+    }
+
+    // Report stream performance; fails the run on assertion violation.
+    intf->stream_monitor()->report(std::cout);
+    intf->stream_monitor()->check();
+
+    for (const SignatureChecker<N>& sig : signatures_) {
+      sig.report(std::cout);
+      if (sig.mismatched_frames_n() != 0) {
+        throw std::runtime_error("Output signature mismatch");
+      }
+      if (sig.unexpected_n() != 0) {
+        throw std::runtime_error("Unexpected output (signature)");
+      }
+    }
+
+    // Expectations of the two most recently presented frames may yet be in
+    // flight, as the final kernels of a frame are flushed only by the lines
+    // of its successor. Any other expectation remaining was never emitted.
+    const std::size_t inflight_n = posted_kernels_n_[0] + posted_kernels_n_[1];
+    for (std::size_t ch = 0; ch < expected_.size(); ++ch) {
+      const Scoreboard& sb = expected_[ch];
+      const std::string name = "channel " + std::to_string(ch);
+      sb.report(std::cout, name);
+      if (sb.mismatched_n() != 0) {
+        throw std::runtime_error("Output mismatch: " + name);
+      }
+      if (sb.unexpected_n() != 0) {
+        throw std::runtime_error("Unexpected output: " + name);
+      }
+      if ((sb.size() + outstanding_[ch]) > inflight_n) {
+        throw std::runtime_error("Expected output not received: " + name);
+      }
+    }
   }
 
   // Override to provide next frame to be processed.
   virtual Frame<vluint8_t> next_frame() = 0;
 
+ protected:
+  // Override to provide the next frame of each of (n) interleaved channels;
+  // frames must be of equal dimension. By default, channel 0 is provided by
+  // next_frame() and all others are of random content.
+  virtual std::vector<Frame<vluint8_t>> next_frames(std::size_t n) {
+    std::vector<Frame<vluint8_t>> frames;
+    frames.push_back(next_frame());
+    FrameGenerator<vluint8_t> gen{frames.front().width(),
+      frames.front().height(), FrameGenerator<vluint8_t>::Pattern::Random};
+    while (frames.size() < n) {
+      frames.push_back(gen.generate());
+    }
+    return frames;
+  }
+
+  // Override to draw (separable) filter coefficients from the separable sets
+  // on all FILTER instances. Outputs are then additionally validated against
+  // the separable reference.
+  virtual bool separable_coefficients() const noexcept { return false; }
+
+  // Coefficient set in the absence of the 'coeff' argument.
+  virtual std::string default_coefficients() const { return "gaussian"; }
+
+  // Traffic profiles in the absence of the 's_traffic' and 'm_traffic'
+  // arguments.
+  virtual std::string default_s_traffic() const { return "full"; }
+  virtual std::string default_m_traffic() const { return "bernoulli:0.7"; }
+
+  // Invoked on the first kernel of each frame following the last kernel of
+  // its predecessor (across all channels) with the number of intervening
+  // cycles in which the output was ready, yet no kernel was presented.
+  virtual void on_frame_gap(std::size_t cycles_n) {}
+
+  // Invoked on each kernel consumed from channel ch, at row y and column x
+  // of its frame.
+  virtual void on_kernel(std::size_t ch, std::size_t y, std::size_t x) {}
+
+  const tb::TestArgs& targs() const noexcept { return targs_; }
+
+  // Pixels per clock of the instance; frame widths must be a multiple.
+  std::size_t ppc() const noexcept { return ppc_; }
+
+  bool coverage_goals_met() const noexcept {
+    return cov_ && cov_->model().goals_met();
+  }
+
+ public:
   void on_negedge(tb::ProjectInstanceBase* instance) override {
-    ConvTestbenchInterface* intf = cast_interface(instance);
+    Interface* intf = cast_interface(instance);
 
-    // Pixel to be emitted in the current cycle.
-    bool emit_pixel = true;
+    // Pixel to be emitted in the current cycle; coefficients are loaded
+    // before the first pixel is emitted. Once presented, a beat is held
+    // until accepted, irrespective of the input traffic profile (see
+    // tb::axis::BeatDriver).
+    const bool s_active = s_traffic_->next();
+    const bool emit_pixel = !on_negedge_coeff(intf) && s_active;
 
-    bool apply_backpressure = tb::RANDOM.random_bool(0.3f);
+    const bool apply_backpressure = !m_traffic_->next();
     // Apply backpressure
     m_in_ = MasterInterfaceIn{!apply_backpressure};
     intf->m_in(m_in_);
@@ -409,24 +1348,28 @@ class ConvTestDriver : public tb::GenericSynchronousTest {
     // requires evaluation of UUT to propagate tready signal.
     intf->eval();
 
-    // Sample outputs
-    s_out_ = intf->s_out();
-    m_out_ = intf->m_out();
+    // Sample outputs; the Master beat is decoded only when transferred.
+    const MasterInterfaceOut<vluint8_t, N>* m_out = intf->m_sample();
+    if (in_frame_gap_ && m_in_.m_tready && !m_out) {
+      ++frame_gap_cycles_n_;
+    }
+
+    // Sample coverage
+    cov_->sample_lb_skid(intf->lb_skid());
 
-    // Evaluate TB -> UUT interface
-    on_negedge_internal_in(intf, emit_pixel, apply_backpressure);
+    // Evaluate TB -> UUT interface; drives new inputs.
+    on_negedge_internal_in(intf, emit_pixel);
 
     // Evaluate UUT -> TB interface
-    on_negedge_internal_out(intf, apply_backpressure);
+    on_negedge_internal_out(intf, m_out);
 
-    // Drive new inputs
-    intf->s_in(s_in_);
+    // Sample stream handshakes for the upcoming edge.
+    intf->stream_monitor()->sample();
   }
 
  private:
-  ConvTestbenchInterface* cast_interface(tb::ProjectInstanceBase* instance) {
-    ConvTestbenchInterface* intf =
-      dynamic_cast<ConvTestbenchInterface*>(instance);
+  Interface* cast_interface(tb::ProjectInstanceBase* instance) {
+    Interface* intf = dynamic_cast<Interface*>(instance);
     if (!intf) {
       throw std::runtime_error(
         "ProjectInstanceBase is not of type ConvTestbenchInterface");
@@ -434,130 +1377,476 @@ class ConvTestDriver : public tb::GenericSynchronousTest {
     return intf;
   }
 
-  void on_negedge_internal_in(
-    ConvTestbenchInterface* intf, bool emit_pixel, bool apply_backpressure) {
-    if (!emit_pixel) {
-      // Idle input interface
-      s_in_ = SlaveInterfaceIn<vluint8_t>{};
-      return;
-    }
-
-    if (frame_tx_.frame_exhausted()) {
-      // Obtain next frame from child.
-      frame_ = next_frame();
-      frame_tx_.init(std::addressof(*frame_));
+  void on_negedge_internal_in(Interface* intf, bool emit_pixel) {
+    // Frames are fetched only once all beats of their predecessors have
+    // been presented, and when a beat is to be emitted.
+    if (emit_pixel && intf->s_empty() && frame_tx_.frame_exhausted()) {
+      // Frame set-up is amortized over the cycles of the frame; its
+      // allocations (frames of the child, shared with the golden model)
+      // are exempt from strict allocation mode (see tb/alloc.h).
+      tb::alloc::ColdPathScope cold_path;
+
+      // Obtain next frame of each channel from child.
+      frames_ = std::make_shared<std::vector<Frame<vluint8_t>>>(
+          next_frames(channel_n_));
+      if (frames_->size() != channel_n_) {
+        throw std::runtime_error("Frame count differs from channel count");
+      }
+      for (const Frame<vluint8_t>& frame : *frames_) {
+        if ((frame.width() != frames_->front().width()) ||
+            (frame.height() != frames_->front().height())) {
+          throw std::runtime_error("Channel frames differ in dimension");
+        }
+        if ((frame.width() % ppc_) != 0) {
+          throw std::runtime_error(
+            "Frame width is not a multiple of pixels per clock");
+        }
+      }
+      frame_tx_.init(frames_.get(), ppc_);
 
-      // Compute expected convolutions.
-      ConvolutionEngine<vluint8_t, 5> ceng{*frame_};
-      ceng.generate(std::back_inserter(expected_));
+      // Compute expected convolutions of each channel; by the golden model,
+      // ahead of the output, unless checking signatures.
+      if (golden_) {
+        golden_->post(frames_);
+      }
+      posted_kernels_n_[0] = posted_kernels_n_[1];
+      posted_kernels_n_[1] =
+        frames_->front().width() * frames_->front().height();
+      for (std::size_t ch = 0; ch < channel_n_; ++ch) {
+        const Frame<vluint8_t>& frame = (*frames_)[ch];
+        if (!signatures_.empty()) {
+          signatures_[ch].push_frame(frame);
+        } else {
+          outstanding_[ch] += frame.width() * frame.height();
+        }
+        expected_pos_[ch].push_frame(frame.width(), frame.height());
+      }
     }
 
-    // Provide next pixel to input interface
-    s_in_ = frame_tx_.next();
-
-    // Consume pixel if accepted
-    if (s_out_.tready) {
+    // Queue the beats of the current frame ahead of the driver.
+    while (!frame_tx_.frame_exhausted() && !intf->s_full()) {
+      intf->s_push(frame_tx_.next());
       frame_tx_.advance();
     }
+
+    // Provide next pixel to input interface, or idle.
+    const SlaveInterfaceIn<vluint8_t>* in = intf->s_drive(emit_pixel);
+    s_in_ = in ? *in : SlaveInterfaceIn<vluint8_t>{};
+
+    // Sample coverage of the beat presented at the upcoming edge, if any;
+    // backpressure is that applied over the same cycle.
+    cov_->sample_in(s_in_.tvalid, s_in_.tuser, s_in_.tlast, !m_in_.m_tready);
   }
 
   void on_negedge_internal_out(
-    ConvTestbenchInterface* intf, bool apply_backpressure) {
+    Interface* intf, const MasterInterfaceOut<vluint8_t, N>* out) {
     // Check Master (out) interface
-    if (!m_out_.m_tvalid || !m_in_.m_tready) {
+    if (!out) {
       return;
     }
 
-    if (m_out_.m_tvalid && expected_.empty()) {
-      std::cout << "Received unexpected output kernel:\n";
-      m_out_.m_tdata.os(std::cout);
-      return;
+    // Kernels are emitted in raster order of each channel, lane 0 first;
+    // channels in strict rotation, as presented at ingress.
+    const std::size_t ch = expected_ch_;
+    if (out->m_tid != ch) {
+      throw std::runtime_error(
+        "Output channel ID mismatch: expected " + std::to_string(ch) +
+        ", got " + std::to_string(out->m_tid));
+    }
+    expected_ch_ = (ch + 1) % channel_n_;
+    if (golden_) {
+      take_expected(ch, ppc_);
+    }
+    for (std::size_t i = 0; i < ppc_; ++i) {
+      if (!signatures_.empty()) {
+        const std::uint8_t* a = coeffs_ ? &out->m_tpixel[i]
+                                        : &out->m_tdata[i].data[0][0];
+        SignatureChecker<N>& sig = signatures_[ch];
+        const std::size_t mismatched_n = sig.mismatched_windows_n();
+        if (sig.observe(a, intf->cycle())) {
+          advance_kernel_position(ch);
+        } else {
+          intf->on_failure();
+        }
+        if (sig.mismatched_windows_n() != mismatched_n) {
+          intf->on_failure();
+        }
+      } else if (coeffs_) {
+        on_negedge_internal_out_pixel(intf, ch, out->m_tpixel[i]);
+      } else {
+        on_negedge_internal_out_kernel(intf, ch, out->m_tdata[i]);
+      }
     }
+  }
 
-    if (expected_.empty()) {
-      return;
+  // Transfer expected kernels from the golden model to the scoreboards, until
+  // at least n are expected on channel ch (or none remain outstanding). The
+  // model emits kernels in the order of the UUT, hence those of the beat.
+  void take_expected(std::size_t ch, std::size_t n) {
+    typename GoldenModel<N>::Expected e;
+    while ((expected_[ch].size() < n) && (outstanding_[ch] != 0)) {
+      golden_->take(e);
+      expected_[e.ch].push_back(e.kernel);
+      --outstanding_[e.ch];
+    }
+  }
+
+  // Construct filter coefficients and the sequence in which they are loaded.
+  // Separable instances are loaded with their vertical then horizontal taps
+  // (see conv_pkg::coeff_span_t); all others with the 2D coefficients.
+  void init_coefficients(bool is_separable_impl) {
+    const std::string name =
+      targs_.get("coeff").value_or(default_coefficients());
+    coeff_load_.clear();
+    if (is_separable_impl || separable_coefficients()) {
+      sep_coeffs_ = make_separable_coefficients<N>(name);
+      coeffs_ = sep_coeffs_->outer();
+    } else {
+      coeffs_ = make_coefficients<N>(name);
+    }
+    if (is_separable_impl) {
+      coeff_load_.insert(coeff_load_.end(), sep_coeffs_->v, sep_coeffs_->v + N);
+      coeff_load_.insert(coeff_load_.end(), sep_coeffs_->h, sep_coeffs_->h + N);
+    } else {
+      for (std::size_t j = 0; j < N; ++j) {
+        for (std::size_t i = 0; i < N; ++i) {
+          const std::int16_t c = coeffs_->data[j][i];
+          if ((c < INT8_MIN) || (c > INT8_MAX)) {
+            throw std::runtime_error("Coefficient exceeds conv_pkg::coeff_t");
+          }
+          coeff_load_.push_back(static_cast<std::int8_t>(c));
+        }
+      }
     }
+  }
 
-    // Otherwise, consume and validate output kernel.
-    if (!equal(m_out_.m_tdata, expected_.front())) {
+  // Drive coefficient load interface; returns true while loading.
+  bool on_negedge_coeff(Interface* intf) {
+    if (!coeffs_ || (coeff_idx_ == coeff_load_.size())) {
+      intf->coeff_in(CoeffLoadIn{coeffs_ ? coeffs_->shift : 0});
+      return false;
+    }
+    CoeffLoadIn in{coeffs_->shift};
+    in.vld = true;
+    in.idx = coeff_idx_;
+    in.dat = coeff_load_[coeff_idx_];
+    intf->coeff_in(in);
+    ++coeff_idx_;
+    return true;
+  }
+
+  void on_negedge_internal_out_pixel(
+    Interface* intf, std::size_t ch, vluint8_t pixel) {
+    // Validate against the filtered expected kernel. Separable
+    // coefficients are additionally cross-checked between the 2D and the
+    // separable reference.
+    using Engine = ConvolutionEngine<vluint8_t, N>;
+    const auto filter = [&](const Kernel<vluint8_t, N>& e) {
+      const vluint8_t p = Engine::filter(e, *coeffs_);
+      if (sep_coeffs_ && (Engine::filter_separable(e, *sep_coeffs_) != p)) {
+        throw std::runtime_error(
+          "Separable reference disagrees with 2D reference");
+      }
+      return p;
+    };
+    const auto on_mismatch = [&](const Kernel<vluint8_t, N>& e,
+                               vluint8_t p) {
+      intf->on_failure();
       std::cout << "Mismatch detected " << std::dec << intf->cycle() << ":\n";
-      std::cout << "Received:\n";
-      m_out_.m_tdata.os(std::cout);
-      std::cout << "Expected:\n";
-      expected_.front().os(std::cout);
-    } else {
-      std::cout << "Kernel match " << std::dec << intf->cycle() << ":\n";
-      std::cout << "Received:\n";
-      m_out_.m_tdata.os(std::cout);
+      std::cout << "Channel: " << ch << " Received: " << std::hex
+                << static_cast<uint32_t>(p)
+                << " Expected: " << static_cast<uint32_t>(filter(e)) << "\n";
+      std::cout << "Kernel:\n";
+      e.os(std::cout);
+    };
+    const typename Scoreboard::Result r = expected_[ch].observe(pixel,
+      [&](const Kernel<vluint8_t, N>& e, vluint8_t p) {
+        return p == filter(e);
+      },
+      on_mismatch);
+    if (r == Scoreboard::Result::Unexpected) {
+      intf->on_failure();
+      std::cout << "Received unexpected output pixel: " << std::hex
+                << static_cast<uint32_t>(pixel) << "\n";
+      return;
+    }
+
+    advance_kernel_position(ch);
+  }
+
+  void on_negedge_internal_out_kernel(
+    Interface* intf, std::size_t ch, const Kernel<vluint8_t, N>& kernel) {
+    // Consume and validate output kernel.
+    const typename Scoreboard::Result r = expected_[ch].observe(kernel,
+      [](const Kernel<vluint8_t, N>& e, const Kernel<vluint8_t, N>& k) {
+        return equal(k, e);
+      },
+      [&](const Kernel<vluint8_t, N>& e, const Kernel<vluint8_t, N>& k) {
+        intf->on_failure();
+        std::cout << "Mismatch detected " << std::dec << intf->cycle()
+                  << ":\n";
+        std::cout << "Channel: " << ch << " Received:\n";
+        k.os(std::cout);
+        std::cout << "Expected:\n";
+        e.os(std::cout);
+      });
+    if (r == Scoreboard::Result::Unexpected) {
+      intf->on_failure();
+      std::cout << "Received unexpected output kernel:\n";
+      kernel.os(std::cout);
+      return;
     }
 
-    expected_.pop_front();
+    advance_kernel_position(ch);
+  }
+
+  // Advance past the kernel consumed from channel ch. Frame boundaries
+  // delimit the measurement of inter-frame gaps; a frame begins on channel
+  // 0 and ends on channel (C - 1).
+  void advance_kernel_position(std::size_t ch) {
+    KernelPositionTracker& pos = expected_pos_[ch];
+    cov_->sample_kernel(pos.y(), pos.x(), pos.height(), pos.width());
+    const bool is_first = (ch == 0) && (pos.y() == 0) && (pos.x() == 0);
+    const bool is_last = (ch == (channel_n_ - 1)) &&
+                         (pos.y() == (pos.height() - 1)) &&
+                         (pos.x() == (pos.width() - 1));
+    if (is_first && in_frame_gap_) {
+      in_frame_gap_ = false;
+      on_frame_gap(frame_gap_cycles_n_);
+    }
+    if (is_last) {
+      in_frame_gap_ = true;
+      frame_gap_cycles_n_ = 0;
+    }
+    on_kernel(ch, pos.y(), pos.x());
+    pos.advance();
   }
 
+  tb::TestArgs targs_;
+  std::size_t ppc_{1};
+
+  // Filter coefficients (FILTER output mode only); the equivalent 2D
+  // coefficients of separable taps where applicable.
+  std::optional<Coefficients<N>> coeffs_;
+  std::optional<SeparableCoefficients<N>> sep_coeffs_;
+
+  // Coefficient load sequence (by index), and next to be loaded.
+  std::vector<std::int8_t> coeff_load_;
+  std::size_t coeff_idx_{0};
+  std::optional<ConvCoverage<N>> cov_;
+
+  // Traffic profiles of the input (TVALID) and output (TREADY) interfaces.
+  std::optional<tb::traffic::Profile> s_traffic_;
+  std::optional<tb::traffic::Profile> m_traffic_;
+
+  // Output cycles lost since the last kernel of the preceding frame.
+  bool in_frame_gap_{false};
+  std::size_t frame_gap_cycles_n_{0};
+
+  // Interleaved channels; expected kernels are tracked per channel.
+  std::size_t channel_n_{1};
+  std::vector<KernelPositionTracker> expected_pos_;
+
+  // Channel of the next output beat.
+  std::size_t expected_ch_{0};
+
   FrameTransactor frame_tx_;
-  std::optional<Frame<vluint8_t>> frame_;
-  std::deque<Kernel<vluint8_t, 5>> expected_;
+  std::shared_ptr<std::vector<Frame<vluint8_t>>> frames_;
+  std::vector<Scoreboard> expected_;
+
+  // Expected kernels yet to be taken from the golden model, per channel.
+  std::vector<std::size_t> outstanding_;
+
+  // Kernels per channel of the two most recently presented frames (oldest
+  // first); these may remain outstanding at the end of the test.
+  std::array<std::size_t, 2> posted_kernels_n_{};
+  std::optional<GoldenModel<N>> golden_;
+
+  // Per channel signatures, in place of expected kernels (check=signature).
+  std::vector<SignatureChecker<N>> signatures_;
 };
 
-template <VConvModule UUT>
-class ConvTestbench final : public tb::GenericSynchronousProjectInstance<UUT>,
-                            public ConvTestbenchInterface {
+// Testbench of an instance; Cfg is the rendered configuration of the
+// instance (see cfg/<instance>.h), from which the testbench is specialized.
+template <VConvModule UUT, typename Cfg>
+class ConvTestbench final
+    : public tb::GenericSynchronousProjectInstance<UUT>,
+      public ConvTestbenchInterface<Cfg::KERNEL_DIAMETER_N> {
  public:
   using base_type = tb::GenericSynchronousProjectInstance<UUT>;
 
+  // Kernel diameter (see conv_pkg::KERNEL_DIAMETER_N).
+  static constexpr std::size_t N = Cfg::KERNEL_DIAMETER_N;
+
+  // Pixels per clock (see conv_pkg::PPC).
+  static constexpr std::size_t PPC = Cfg::PPC;
+
+  static_assert((Cfg::PIXEL_W == PIXEL_W) && (Cfg::PPC_MAX == PPC_MAX) &&
+                    (Cfg::IMAGE_MAX_W == IMAGE_MAX_W) &&
+                    (Cfg::LB_ASIC_SRAM_W == PkgCfg::LB_ASIC_SRAM_W) &&
+                    (Cfg::MAC_SHIFT_W == PkgCfg::MAC_SHIFT_W),
+    "Instance package constants differ from the default instance.");
+  static_assert(PPC <= PPC_MAX, "Instance PPC exceeds PPC_MAX.");
+
+  // Depth of the Slave beat queue.
+  static constexpr std::size_t S_QUEUE_N = 16;
+
+  // Bindings of the Slave (ingress) and Master (egress) interfaces to the
+  // ports of the UUT (see tb/axis_vip.h); the pixel group and kernel layout
+  // are resolved from the configuration of the instance.
+  struct SlaveBinding {
+    using model_type = UUT;
+    using beat_type = SlaveInterfaceIn<vluint8_t>;
+
+    static bool valid(const UUT& m) noexcept {
+      return tb::vsupport::from_v<bool>(m.s_tvalid_i);
+    }
+
+    static bool ready(const UUT& m) noexcept {
+      return tb::vsupport::from_v<bool>(m.s_tready_o);
+    }
+
+    static beat_type beat(const UUT& m) noexcept {
+      beat_type in{};
+      in.tvalid = valid(m);
+      for (std::size_t i = 0; i < PPC; ++i) {
+        in.tdata[i] = tb::vsupport::bits(m.s_tdata_i, i * PIXEL_W, PIXEL_W);
+      }
+      in.tlast = tb::vsupport::from_v<bool>(m.s_tlast_i);
+      in.tuser = tb::vsupport::from_v<bool>(m.s_tuser_i);
+      in.tid = m.s_tid_i;
+      return in;
+    }
+
+    static void drive(UUT& m, const beat_type& in) noexcept {
+      m.s_tvalid_i = tb::vsupport::to_v(in.tvalid);
+      // Pixel group is at most 32b (PPC_MAX * PIXEL_W).
+      vluint32_t tdata = 0;
+      for (std::size_t i = 0; i < PPC; ++i) {
+        tdata |= static_cast<vluint32_t>(in.tdata[i]) << (i * PIXEL_W);
+      }
+      m.s_tdata_i = tdata;
+      m.s_tlast_i = tb::vsupport::to_v(in.tlast);
+      m.s_tuser_i = tb::vsupport::to_v(in.tuser);
+      m.s_tid_i = in.tid;
+    }
+
+    static void idle(UUT& m) noexcept { drive(m, beat_type{}); }
+  };
+
+  struct MasterBinding {
+    using model_type = UUT;
+    using beat_type = MasterInterfaceOut<vluint8_t, N>;
+
+    static bool valid(const UUT& m) noexcept {
+      return tb::vsupport::from_v<bool>(m.m_tvalid_o);
+    }
+
+    static bool ready(const UUT& m) noexcept {
+      return tb::vsupport::from_v<bool>(m.m_tready_i);
+    }
+
+    static beat_type beat(const UUT& m) noexcept {
+      beat_type out{};
+      out.m_tvalid = valid(m);
+      out.m_tid = m.m_tid_o;
+
+      if constexpr (Cfg::OUTPUT_MODE == "FILTER") {
+        // Packed conv_pkg::pixel_group_t.
+        for (std::size_t i = 0; i < PPC; ++i) {
+          out.m_tpixel[i] =
+            tb::vsupport::bits(m.m_tdata_o, i * PIXEL_W, PIXEL_W);
+        }
+      } else {
+        // Packed conv_pkg::kernel_group_t; pixel [i][j][k] (lane, row,
+        // column) is at offset ((i * N + j) * N + k) * PIXEL_W.
+        for (std::size_t i = 0; i < PPC; ++i) {
+          for (std::size_t j = 0; j < N; ++j) {
+            for (std::size_t k = 0; k < N; ++k) {
+              const std::size_t lsb = ((i * N + j) * N + k) * PIXEL_W;
+              out.m_tdata[i].data[j][k] =
+                tb::vsupport::bits(m.m_tdata_o, lsb, PIXEL_W);
+            }
+          }
+        }
+      }
+      return out;
+    }
+  };
+
   SlaveInterfaceIn<vluint8_t> s_in() const noexcept override {
-    SlaveInterfaceIn<vluint8_t> in{};
-    in.tvalid = tb::vsupport::from_v<bool>(uut()->s_tvalid_i);
-    in.tdata = uut()->s_tdata_i;
-    in.tlast = tb::vsupport::from_v<bool>(uut()->s_tlast_i);
-    in.tuser = tb::vsupport::from_v<bool>(uut()->s_tuser_i);
-    return in;
+    return SlaveBinding::beat(*uut());
   }
 
   void s_in(const SlaveInterfaceIn<vluint8_t>& in) noexcept override {
-    uut()->s_tvalid_i = tb::vsupport::to_v(in.tvalid);
-    uut()->s_tdata_i = in.tdata;
-    uut()->s_tlast_i = tb::vsupport::to_v(in.tlast);
-    uut()->s_tuser_i = tb::vsupport::to_v(in.tuser);
+    SlaveBinding::drive(*uut(), in);
   }
 
   SlaveInterfaceOut s_out() const noexcept override {
     SlaveInterfaceOut out{};
-    out.tready = tb::vsupport::from_v<bool>(uut()->s_tready_o);
+    out.tready = SlaveBinding::ready(*uut());
     return out;
   }
 
-  MasterInterfaceOut<vluint8_t, 5> m_out() const noexcept override {
-    MasterInterfaceOut<vluint8_t, 5> out{};
-    out.m_tvalid = tb::vsupport::from_v<bool>(uut()->m_tvalid_o);
-
-    out.m_tdata.data[0][0] = uut()->m_tdata_0_0_o;
-    out.m_tdata.data[0][1] = uut()->m_tdata_0_1_o;
-    out.m_tdata.data[0][2] = uut()->m_tdata_0_2_o;
-    out.m_tdata.data[0][3] = uut()->m_tdata_0_3_o;
-    out.m_tdata.data[0][4] = uut()->m_tdata_0_4_o;
-    out.m_tdata.data[1][0] = uut()->m_tdata_1_0_o;
-    out.m_tdata.data[1][1] = uut()->m_tdata_1_1_o;
-    out.m_tdata.data[1][2] = uut()->m_tdata_1_2_o;
-    out.m_tdata.data[1][3] = uut()->m_tdata_1_3_o;
-    out.m_tdata.data[1][4] = uut()->m_tdata_1_4_o;
-    out.m_tdata.data[2][0] = uut()->m_tdata_2_0_o;
-    out.m_tdata.data[2][1] = uut()->m_tdata_2_1_o;
-    out.m_tdata.data[2][2] = uut()->m_tdata_2_2_o;
-    out.m_tdata.data[2][3] = uut()->m_tdata_2_3_o;
-    out.m_tdata.data[2][4] = uut()->m_tdata_2_4_o;
-    out.m_tdata.data[3][0] = uut()->m_tdata_3_0_o;
-    out.m_tdata.data[3][1] = uut()->m_tdata_3_1_o;
-    out.m_tdata.data[3][2] = uut()->m_tdata_3_2_o;
-    out.m_tdata.data[3][3] = uut()->m_tdata_3_3_o;
-    out.m_tdata.data[3][4] = uut()->m_tdata_3_4_o;
-    out.m_tdata.data[4][0] = uut()->m_tdata_4_0_o;
-    out.m_tdata.data[4][1] = uut()->m_tdata_4_1_o;
-    out.m_tdata.data[4][2] = uut()->m_tdata_4_2_o;
-    out.m_tdata.data[4][3] = uut()->m_tdata_4_3_o;
-    out.m_tdata.data[4][4] = uut()->m_tdata_4_4_o;
+  bool s_push(const SlaveInterfaceIn<vluint8_t>& in) noexcept override {
+    return s_driver_.push(in);
+  }
+
+  bool s_empty() const noexcept override { return s_driver_.empty(); }
 
-    return out;
+  bool s_full() const noexcept override { return s_driver_.full(); }
+
+  const SlaveInterfaceIn<vluint8_t>* s_drive(bool active) noexcept override {
+    return s_driver_.drive(*uut(), active);
+  }
+
+  MasterInterfaceOut<vluint8_t, N> m_out() const noexcept override {
+    return MasterBinding::beat(*uut());
+  }
+
+  const MasterInterfaceOut<vluint8_t, N>* m_sample() noexcept override {
+    return m_monitor_.sample(*uut());
+  }
+
+  LbSkidState<N> lb_skid() const noexcept override {
+    LbSkidState<N> s{};
+    const std::size_t groups_n = LB_ASIC_PIXELS_PER_WORD_N / PPC;
+    const std::size_t idx_w = std::bit_width(groups_n - 1);
+    for (std::size_t i = 0; i < N; ++i) {
+      s.vld[i] = (uut()->tb_lb_skid_vld_o >> i) & 1;
+      s.idx[i] =
+        (uut()->tb_lb_skid_idx_o >> (i * idx_w)) & ((1 << idx_w) - 1);
+    }
+    return s;
+  }
+
+  std::string cfg_target() const override { return uut()->cfg_target_o; }
+
+  std::size_t cfg_kernel_diameter() const override {
+    return uut()->cfg_kernel_diameter_o;
+  }
+
+  std::size_t cfg_ppc() const override { return uut()->cfg_ppc_o; }
+
+  std::size_t cfg_channel_n() const override { return uut()->cfg_channel_n_o; }
+
+  std::string cfg_output_mode() const override {
+    return uut()->cfg_output_mode_o;
+  }
+
+  std::string cfg_filter_impl() const override {
+    return uut()->cfg_filter_impl_o;
+  }
+
+  void coeff_in(const CoeffLoadIn& in) noexcept override {
+    uut()->coeff_vld_i = tb::vsupport::to_v(in.vld);
+    uut()->coeff_idx_i = in.idx;
+    uut()->coeff_dat_i = static_cast<vluint8_t>(in.dat);
+    uut()->coeff_shift_i = in.shift;
+  }
+
+  tb::axis::PathMonitor* stream_monitor() noexcept override {
+    return monitor_.get();
   }
 
   MasterInterfaceIn m_in() const noexcept override {
@@ -572,6 +1861,10 @@ class ConvTestbench final : public tb::GenericSynchronousProjectInstance<UUT>,
 
   void eval() override { tb::GenericSynchronousProjectInstance<UUT>::eval(); }
 
+  void on_failure() override {
+    tb::GenericSynchronousProjectInstance<UUT>::on_failure();
+  }
+
   std::size_t cycle() override {
     return tb::GenericSynchronousProjectInstance<UUT>::cycle();
   }
@@ -588,31 +1881,50 @@ class ConvTestbench final : public tb::GenericSynchronousProjectInstance<UUT>,
 
  private:
   UUT* uut() const { return base_type::uut(); }
+
+  std::unique_ptr<tb::axis::PathMonitor> monitor_;
+
+  tb::axis::BeatDriver<SlaveBinding> s_driver_{S_QUEUE_N};
+  tb::axis::BeatMonitor<MasterBinding> m_monitor_;
 };
 
-template <VConvModule UUT>
-ConvTestbench<UUT>::ConvTestbench()
+template <VConvModule UUT, typename Cfg>
+ConvTestbench<UUT, Cfg>::ConvTestbench()
     : tb::GenericSynchronousProjectInstance<UUT>("ConvTestbench") {}
 
-template <VConvModule UUT>
-void ConvTestbench<UUT>::elaborate() {
+template <VConvModule UUT, typename Cfg>
+void ConvTestbench<UUT, Cfg>::elaborate() {
   base_type::elaborate();
+
+  // Attach stream monitor to the Slave (ingress) and Master (egress)
+  // interfaces of the UUT.
+  const tb::axis::Ports ingress{.valid = &uut()->s_tvalid_i,
+    .ready = &uut()->s_tready_o,
+    .last = &uut()->s_tlast_i,
+    .user = &uut()->s_tuser_i};
+  const tb::axis::Ports egress{.valid = &uut()->m_tvalid_o,
+    .ready = &uut()->m_tready_i,
+    .last = &uut()->m_tlast_o,
+    .user = &uut()->m_tuser_o};
+  monitor_ = std::make_unique<tb::axis::PathMonitor>(
+    this->name(), ingress, egress, PPC);
 }
 
-template <VConvModule UUT>
-void ConvTestbench<UUT>::initialize() {
+template <VConvModule UUT, typename Cfg>
+void ConvTestbench<UUT, Cfg>::initialize() {
   base_type::initialize();
 }
 
-template <VConvModule UUT>
-void ConvTestbench<UUT>::finalize() {
+template <VConvModule UUT, typename Cfg>
+void ConvTestbench<UUT, Cfg>::finalize() {
   base_type::finalize();
 }
 
-class BasicIncrementConvTest final : public ConvTestDriver {
+template <std::size_t N>
+class BasicIncrementConvTest final : public ConvTestDriver<N> {
  public:
   explicit BasicIncrementConvTest(const std::string& args)
-      : ConvTestDriver(args) {
+      : ConvTestDriver<N>(args) {
     frame_gen_ = std::make_unique<FrameGenerator<vluint8_t>>(
       16, 16, FrameGenerator<vluint8_t>::Pattern::ByRow);
   }
@@ -623,6 +1935,372 @@ class BasicIncrementConvTest final : public ConvTestDriver {
   std::unique_ptr<FrameGenerator<vluint8_t>> frame_gen_;
 };
 
+// Randomized test: frames of random dimension and content are streamed until
+// all coverage goals have been closed, or until the cycle budget has been
+// exhausted, in which case the test fails (the open bins are reported).
+// Coverage may be seeded from, and saved to, a database such that parallel
+// jobs (each with a differing seed) may collectively close goals.
+//
+// Arguments (in addition to those of ConvTestDriver):
+//
+//   max_cycles=<n>      Cycle budget (default: 1000000).
+//
+template <std::size_t N>
+class RandomCoverageConvTest final : public ConvTestDriver<N> {
+ public:
+  explicit RandomCoverageConvTest(const std::string& args)
+      : ConvTestDriver<N>(args) {
+    max_cycles_n_ = this->targs().template get_or<std::size_t>(
+      "max_cycles", 1'000'000);
+  }
+
+  Frame<vluint8_t> next_frame() override {
+    // Minimum dimension such that all border positions are distinct.
+    constexpr std::size_t DIM_MIN = N;
+    constexpr std::size_t DIM_MAX = 32;
+
+    // Width is rounded up to a multiple of the pixels per clock.
+    const std::size_t ppc = this->ppc();
+    std::size_t w = tb::RANDOM.uniform<std::size_t>(DIM_MAX, DIM_MIN);
+    w = ((w + ppc - 1) / ppc) * ppc;
+    const std::size_t h = tb::RANDOM.uniform<std::size_t>(DIM_MAX, DIM_MIN);
+    FrameGenerator<vluint8_t> gen(
+      w, h, FrameGenerator<vluint8_t>::Pattern::Random);
+    return gen.generate();
+  }
+
+  void fini(tb::ProjectInstanceBase* base) override {
+    ConvTestDriver<N>::fini(base);
+    if (!this->coverage_goals_met()) {
+      throw std::runtime_error("Coverage goals not met within cycle budget");
+    }
+  }
+
+  bool is_complete() const noexcept override {
+    return this->coverage_goals_met();
+  }
+
+  std::size_t max_cycles_n() const noexcept override { return max_cycles_n_; }
+
+ private:
+  std::size_t max_cycles_n_;
+};
+
+// Separable filter test: frames of random dimension and content are filtered
+// by separable coefficients. On separable instances, validates conv_sep
+// against the 2D reference; on full instances, validates the 2D datapath
+// against the separable reference. Both references are cross-checked on each
+// output pixel.
+//
+// Arguments (in addition to those of ConvTestDriver):
+//
+//   max_cycles=<n>      Cycle budget (default: 20000).
+//   coeff=<set>         Separable coefficient set (default: random).
+//
+template <std::size_t N>
+class SeparableFilterConvTest final : public ConvTestDriver<N> {
+ public:
+  explicit SeparableFilterConvTest(const std::string& args)
+      : ConvTestDriver<N>(args) {
+    max_cycles_n_ =
+      this->targs().template get_or<std::size_t>("max_cycles", 20'000);
+  }
+
+  Frame<vluint8_t> next_frame() override {
+    constexpr std::size_t DIM_MIN = N;
+    constexpr std::size_t DIM_MAX = 32;
+
+    const std::size_t ppc = this->ppc();
+    std::size_t w = tb::RANDOM.uniform<std::size_t>(DIM_MAX, DIM_MIN);
+    w = ((w + ppc - 1) / ppc) * ppc;
+    const std::size_t h = tb::RANDOM.uniform<std::size_t>(DIM_MAX, DIM_MIN);
+    FrameGenerator<vluint8_t> gen(
+      w, h, FrameGenerator<vluint8_t>::Pattern::Random);
+    return gen.generate();
+  }
+
+  std::size_t max_cycles_n() const noexcept override { return max_cycles_n_; }
+
+ protected:
+  bool separable_coefficients() const noexcept override { return true; }
+
+  std::string default_coefficients() const override { return "random"; }
+
+ private:
+  std::size_t max_cycles_n_;
+};
+
+// Streaming test: frames of varying dimension, with widths up to
+// IMAGE_MAX_W, are streamed back to back at full throughput. The output
+// cycles lost between the last kernel of one frame and the first kernel of
+// the next are measured at each boundary and must not exceed the budget.
+// The final kernels of each frame are flushed as the first lines of its
+// successor fill the line buffers.
+//
+// Arguments (in addition to those of ConvTestDriver):
+//
+//   frames=<n>          Frame boundaries to be measured (default: 8).
+//   bubble_budget=<n>   Maximum cycles lost per boundary (default: 0).
+//   max_cycles=<n>      Cycle budget (default: 1000000).
+//
+template <std::size_t N>
+class StreamingConvTest final : public ConvTestDriver<N> {
+ public:
+  explicit StreamingConvTest(const std::string& args)
+      : ConvTestDriver<N>(args) {
+    frames_n_ = this->targs().template get_or<std::size_t>("frames", 8);
+    bubble_budget_ =
+      this->targs().template get_or<std::size_t>("bubble_budget", 0);
+    max_cycles_n_ = this->targs().template get_or<std::size_t>(
+      "max_cycles", 1'000'000);
+  }
+
+  Frame<vluint8_t> next_frame() override {
+    constexpr std::size_t DIM_MIN = N;
+    constexpr std::size_t H_MAX = 2 * N;
+
+    // Resolution changes on every frame; the extremes of width are
+    // presented first.
+    const std::size_t ppc = this->ppc();
+    std::size_t w;
+    switch (frame_i_++) {
+      case 0: w = IMAGE_MAX_W; break;
+      case 1: w = DIM_MIN; break;
+      default: w = tb::RANDOM.uniform<std::size_t>(IMAGE_MAX_W, DIM_MIN);
+    }
+    w = std::min(((w + ppc - 1) / ppc) * ppc, IMAGE_MAX_W);
+    const std::size_t h = tb::RANDOM.uniform<std::size_t>(H_MAX, DIM_MIN);
+    FrameGenerator<vluint8_t> gen(
+      w, h, FrameGenerator<vluint8_t>::Pattern::Random);
+    return gen.generate();
+  }
+
+  void fini(tb::ProjectInstanceBase* base) override {
+    std::cout << "Inter-frame bubbles: " << std::dec << gaps_n_
+              << " boundaries, " << gap_cycles_total_ << " cycles lost, "
+              << gap_cycles_max_ << " max (budget " << bubble_budget_
+              << ")\n";
+    ConvTestDriver<N>::fini(base);
+    if (gaps_n_ < frames_n_) {
+      throw std::runtime_error("Insufficient frame boundaries measured");
+    }
+  }
+
+  bool is_complete() const noexcept override { return gaps_n_ >= frames_n_; }
+
+  bool requires_completion() const noexcept override { return true; }
+
+  std::size_t max_cycles_n() const noexcept override { return max_cycles_n_; }
+
+ protected:
+  std::string default_s_traffic() const override { return "full"; }
+  std::string default_m_traffic() const override { return "full"; }
+
+  void on_frame_gap(std::size_t cycles_n) override {
+    ++gaps_n_;
+    gap_cycles_total_ += cycles_n;
+    gap_cycles_max_ = std::max(gap_cycles_max_, cycles_n);
+    if (cycles_n > bubble_budget_) {
+      throw std::runtime_error(
+        "Inter-frame bubble budget exceeded: " + std::to_string(cycles_n) +
+        " cycles lost (budget " + std::to_string(bubble_budget_) + ")");
+    }
+  }
+
+ private:
+  std::size_t frames_n_;
+  std::size_t bubble_budget_;
+  std::size_t max_cycles_n_;
+
+  std::size_t frame_i_{0};
+  std::size_t gaps_n_{0};
+  std::size_t gap_cycles_total_{0};
+  std::size_t gap_cycles_max_{0};
+};
+
+// Line buffer test (instances with TB_CFG__MEM_MODEL: DPI): the line buffers
+// are inspected through the memory backdoor and checked against the lines
+// presented at the input. Banks are allocated in rotation, a line apiece,
+// from the first line after reset. On the first kernel of row y (of channel
+// 0), lines y - R + 1 to y + R - 1 are complete, yet not overwritten, and
+// must be retained by their banks. Beforehand, each bank is preloaded and
+// read back, such that the pushes of the UUT must overwrite the preloaded
+// contents.
+//
+// Arguments (in addition to those of ConvTestDriver):
+//
+//   frames=<n>          Frames to be checked (default: 4).
+//   max_cycles=<n>      Cycle budget (default: 200000).
+//
+template <std::size_t N>
+class LineBufferConvTest final : public ConvTestDriver<N> {
+  static constexpr std::size_t R = N / 2;
+
+ public:
+  explicit LineBufferConvTest(const std::string& args)
+      : ConvTestDriver<N>(args) {
+    frames_n_ = this->targs().template get_or<std::size_t>("frames", 4);
+    max_cycles_n_ =
+      this->targs().template get_or<std::size_t>("max_cycles", 200'000);
+  }
+
+  void init(tb::ProjectInstanceBase* base) override {
+    ConvTestDriver<N>::init(base);
+    auto* intf = dynamic_cast<ConvTestbenchInterface<N>*>(base);
+    backdoor_.emplace(N, this->ppc(), intf->cfg_target() == "ASIC");
+
+    // Preload each bank with a line of random content, and read it back.
+    std::vector<Frame<vluint8_t>> frames;
+    for (std::size_t ch = 0; ch < intf->cfg_channel_n(); ++ch) {
+      FrameGenerator<vluint8_t> gen(WIDTH_MAX * this->ppc(), N,
+        FrameGenerator<vluint8_t>::Pattern::Random);
+      frames.push_back(gen.generate());
+    }
+    for (std::size_t b = 0; b < N; ++b) {
+      backdoor_->preload(b, frames, b);
+      if (backdoor_->compare(b, frames, b) != 0) {
+        throw std::runtime_error("Line buffer backdoor preload mismatch");
+      }
+    }
+  }
+
+  Frame<vluint8_t> next_frame() override {
+    // Lines of at least WIDTH_MIN beats, such that the kernels of a row are
+    // emitted before the line R + 2 rows beyond is pushed.
+    const std::size_t w = this->ppc() *
+      tb::RANDOM.uniform<std::size_t>(WIDTH_MAX, WIDTH_MIN);
+    const std::size_t h = tb::RANDOM.uniform<std::size_t>(2 * N, N);
+    FrameGenerator<vluint8_t> gen(
+      w, h, FrameGenerator<vluint8_t>::Pattern::Random);
+    return gen.generate();
+  }
+
+  void fini(tb::ProjectInstanceBase* base) override {
+    std::cout << "Line buffer: " << std::dec << lines_checked_n_
+              << " lines checked, " << mismatches_n_ << " pixels mismatched\n";
+    ConvTestDriver<N>::fini(base);
+    if (lines_checked_n_ == 0) {
+      throw std::runtime_error("No line buffer contents checked");
+    }
+    if (mismatches_n_ != 0) {
+      throw std::runtime_error("Line buffer contents mismatch");
+    }
+  }
+
+  bool is_complete() const noexcept override { return frame_i_ > frames_n_; }
+
+  bool requires_completion() const noexcept override { return true; }
+
+  std::size_t max_cycles_n() const noexcept override { return max_cycles_n_; }
+
+ protected:
+  std::vector<Frame<vluint8_t>> next_frames(std::size_t n) override {
+    std::vector<Frame<vluint8_t>> frames = ConvTestDriver<N>::next_frames(n);
+    first_line_.push_back(lines_n_);
+    lines_n_ += frames.front().height();
+    frames_.push_back(frames);
+    return frames;
+  }
+
+  void on_kernel(std::size_t ch, std::size_t y, std::size_t x) override {
+    if ((ch != 0) || (x != 0)) {
+      return;
+    }
+    if (y == 0) {
+      ++frame_i_;
+    }
+    // Lines are indexed from the first after reset.
+    const std::size_t line = first_line_[frame_i_ - 1] + y;
+    const std::size_t lo = (line >= (R - 1)) ? (line - (R - 1)) : 0;
+    const std::size_t hi = std::min(line + R, lines_n_);
+    for (std::size_t l = lo; l < hi; ++l) {
+      // Frame (and row therein) of line l.
+      const std::size_t f = static_cast<std::size_t>(
+        std::upper_bound(first_line_.begin(), first_line_.end(), l) -
+        first_line_.begin() - 1);
+      const std::size_t mismatches_n =
+        backdoor_->compare(l % N, frames_[f], l - first_line_[f]);
+      if (mismatches_n != 0) {
+        std::cout << "Line buffer mismatch: line " << std::dec << l
+                  << " (bank " << (l % N) << "): " << mismatches_n
+                  << " pixels\n";
+      }
+      mismatches_n_ += mismatches_n;
+      ++lines_checked_n_;
+    }
+  }
+
+ private:
+  static constexpr std::size_t WIDTH_MIN = 16;
+  static constexpr std::size_t WIDTH_MAX = 32;
+
+  std::size_t frames_n_;
+  std::size_t max_cycles_n_;
+  std::optional<LineBufferBackdoor> backdoor_;
+
+  // Frames presented (per channel), and the index of their first line.
+  std::vector<std::vector<Frame<vluint8_t>>> frames_;
+  std::vector<std::size_t> first_line_;
+  std::size_t lines_n_{0};
+
+  // Frames whose kernels have been observed.
+  std::size_t frame_i_{0};
+  std::size_t lines_checked_n_{0};
+  std::size_t mismatches_n_{0};
+};
+
+// Dispatches a test to its specialization for the kernel diameter of the
+// instance upon which it is run.
+template <template <std::size_t> class Test>
+class ConvTest final : public tb::GenericSynchronousTest {
+ public:
+  explicit ConvTest(const std::string& args)
+      : tb::GenericSynchronousTest(args) {}
+
+  void init(tb::ProjectInstanceBase* base) override {
+    if (dynamic_cast<ConvTestbenchInterface<3>*>(base)) {
+      test_ = std::make_unique<Test<3>>(args());
+    } else if (dynamic_cast<ConvTestbenchInterface<5>*>(base)) {
+      test_ = std::make_unique<Test<5>>(args());
+    } else if (dynamic_cast<ConvTestbenchInterface<7>*>(base)) {
+      test_ = std::make_unique<Test<7>>(args());
+    } else {
+      throw std::runtime_error("Unsupported conv kernel diameter");
+    }
+    test_->init(base);
+  }
+
+  void fini(tb::ProjectInstanceBase* base) override { test_->fini(base); }
+
+ protected:
+  void on_negedge(tb::ProjectInstanceBase* base) override {
+    test_->on_negedge(base);
+  }
+
+  bool is_complete() const noexcept override { return test_->is_complete(); }
+
+  std::size_t max_cycles_n() const noexcept override {
+    return test_->max_cycles_n();
+  }
+
+  bool requires_completion() const noexcept override {
+    return test_->requires_completion();
+  }
+
+ private:
+  std::unique_ptr<ConvTestDriverBase> test_;
+};
+
+// Testbench of each instance outside the configuration matrix.
+using TbAsicZeropadK3 =
+  ConvTestbench<Vtb_asic_zeropad_k3, cfg::tb_asic_zeropad_k3>;
+using TbAsicZeropadK7 =
+  ConvTestbench<Vtb_asic_zeropad_k7, cfg::tb_asic_zeropad_k7>;
+using TbAsicZeropadK7Sep =
+  ConvTestbench<Vtb_asic_zeropad_k7_sep, cfg::tb_asic_zeropad_k7_sep>;
+using TbAsicZeropadCh3 =
+  ConvTestbench<Vtb_asic_zeropad_ch3, cfg::tb_asic_zeropad_ch3>;
+
 }  // namespace
 
 namespace projects::conv {
@@ -630,10 +2308,29 @@ namespace projects::conv {
 void register_project() {
   TB_PROJECT_CREATE(conv);
 
-  TB_PROJECT_ADD_INSTANCE(
-    conv, tb_asic_zeropad, ConvTestbench<Vtb_asic_zeropad>);
+  TB_PROJECT_ADD_INSTANCE(conv, tb_asic_zeropad_k3, TbAsicZeropadK3);
+
+  TB_PROJECT_ADD_INSTANCE(conv, tb_asic_zeropad_k7, TbAsicZeropadK7);
+
+  TB_PROJECT_ADD_INSTANCE(conv, tb_asic_zeropad_k7_sep, TbAsicZeropadK7Sep);
+
+  TB_PROJECT_ADD_INSTANCE(conv, tb_asic_zeropad_ch3, TbAsicZeropadCh3);
+
+  // Instances of the configuration matrix (see CMakeLists.txt).
+  TB_PROJECT_ADD_MATRIX(conv, ConvTestbench);
+
+  TB_PROJECT_ADD_TEST(
+    conv, basic_increment, ConvTest<BasicIncrementConvTest>);
+
+  TB_PROJECT_ADD_TEST(
+    conv, random_coverage, ConvTest<RandomCoverageConvTest>);
+
+  TB_PROJECT_ADD_TEST(
+    conv, separable_filter, ConvTest<SeparableFilterConvTest>);
+
+  TB_PROJECT_ADD_TEST(conv, streaming, ConvTest<StreamingConvTest>);
 
-  TB_PROJECT_ADD_TEST(conv, basic_increment, BasicIncrementConvTest);
+  TB_PROJECT_ADD_TEST(conv, line_buffer, ConvTest<LineBufferConvTest>);
 
   TB_PROJECT_FINALIZE(conv);
 }
@@ -40,9 +40,10 @@ module tb`TB_CFG__SUFFIX (
 // -------------------------------------------------------------------------- //
 
   input wire logic                           s_tvalid_i
-, input wire conv_pkg::pixel_t               s_tdata_i
+, input wire conv_pkg::pixel_group_t         s_tdata_i
 , input wire logic                           s_tlast_i
 , input wire logic                           s_tuser_i
+, input wire conv_pkg::channel_t             s_tid_i
 
 , output wire logic                          s_tready_o
 
@@ -56,38 +57,37 @@ module tb`TB_CFG__SUFFIX (
 //
 , output wire logic                          m_tvalid_o
 
-, output wire conv_pkg::pixel_t              m_tdata_0_0_o
-, output wire conv_pkg::pixel_t              m_tdata_0_1_o
-, output wire conv_pkg::pixel_t              m_tdata_0_2_o
-, output wire conv_pkg::pixel_t              m_tdata_0_3_o
-, output wire conv_pkg::pixel_t              m_tdata_0_4_o
-
-, output wire conv_pkg::pixel_t              m_tdata_1_0_o
-, output wire conv_pkg::pixel_t              m_tdata_1_1_o
-, output wire conv_pkg::pixel_t              m_tdata_1_2_o
-, output wire conv_pkg::pixel_t              m_tdata_1_3_o
-, output wire conv_pkg::pixel_t              m_tdata_1_4_o
-
-, output wire conv_pkg::pixel_t              m_tdata_2_0_o
-, output wire conv_pkg::pixel_t              m_tdata_2_1_o
-, output wire conv_pkg::pixel_t              m_tdata_2_2_o
-, output wire conv_pkg::pixel_t              m_tdata_2_3_o
-, output wire conv_pkg::pixel_t              m_tdata_2_4_o
-
-, output wire conv_pkg::pixel_t              m_tdata_3_0_o
-, output wire conv_pkg::pixel_t              m_tdata_3_1_o
-, output wire conv_pkg::pixel_t              m_tdata_3_2_o
-, output wire conv_pkg::pixel_t              m_tdata_3_3_o
-, output wire conv_pkg::pixel_t              m_tdata_3_4_o
-
-, output wire conv_pkg::pixel_t              m_tdata_4_0_o
-, output wire conv_pkg::pixel_t              m_tdata_4_1_o
-, output wire conv_pkg::pixel_t              m_tdata_4_2_o
-, output wire conv_pkg::pixel_t              m_tdata_4_3_o
-, output wire conv_pkg::pixel_t              m_tdata_4_4_o
+, output wire logic [cfg_pkg::M_TDATA_W - 1:0]
+                                             m_tdata_o
 
 , output wire logic                          m_tuser_o
 , output wire logic                          m_tlast_o
+, output wire conv_pkg::channel_t            m_tid_o
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Coefficient Load                                                           //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, input wire logic                           coeff_vld_i
+, input wire logic [conv_pkg::COEFF_IDX_W - 1:0]
+                                             coeff_idx_i
+, input wire conv_pkg::coeff_t               coeff_dat_i
+, input wire logic [conv_pkg::MAC_SHIFT_W - 1:0]
+                                             coeff_shift_i
+
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Coverage                                                                   //
+//                                                                            //
+// -------------------------------------------------------------------------- //
+
+, output wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                                             tb_lb_skid_vld_o
+, output wire logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+                    [conv_pkg::LB_ASIC_GROUPS_PER_WORD_W - 1:0]
+                                             tb_lb_skid_idx_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -97,6 +97,11 @@ module tb`TB_CFG__SUFFIX (
 
 , output wire string                         cfg_target_o
 , output wire string                         cfg_extend_strategy_o
+, output wire int                            cfg_ppc_o
+, output wire int                            cfg_kernel_diameter_o
+, output wire int                            cfg_channel_n_o
+, output wire string                         cfg_output_mode_o
+, output wire string                         cfg_filter_impl_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -118,56 +123,54 @@ module tb`TB_CFG__SUFFIX (
 
 `TB_BOILERPLATE_BODY(clk, arst_n)
 
-conv_pkg::kernel_t m_tdata;
-
 conv u_uut (
   .s_tvalid_i        (s_tvalid_i)
 , .s_tdata_i         (s_tdata_i)
 , .s_tlast_i         (s_tlast_i)
 , .s_tuser_i         (s_tuser_i)
+, .s_tid_i           (s_tid_i)
 , .s_tready_o        (s_tready_o)
 , .m_tready_i        (m_tready_i)
 , .m_tvalid_o        (m_tvalid_o)
-, .m_tdata_o         (m_tdata)
+, .m_tdata_o         (m_tdata_o)
 , .m_tuser_o         (m_tuser_o)
 , .m_tlast_o         (m_tlast_o)
+, .m_tid_o           (m_tid_o)
+, .coeff_vld_i       (coeff_vld_i)
+, .coeff_idx_i       (coeff_idx_i)
+, .coeff_dat_i       (coeff_dat_i)
+, .coeff_shift_i     (coeff_shift_i)
+, .tb_lb_skid_vld_o  (lb_skid_vld)
+, .tb_lb_skid_sel_o  (lb_skid_sel)
 , .clk               (clk)
 , .arst_n            (arst_n)
 );
 
-// Unrolling m_tdata array to individual outputs for easier access
-// in the C++ testbench. This could also be done using a preprocessor,
-// or directly in C++.
+// -------------------------------------------------------------------------- //
+//                                                                            //
+// Coverage                                                                   //
+//                                                                            //
+// -------------------------------------------------------------------------- //
 
-assign m_tdata_0_0_o = m_tdata[0][0];
-assign m_tdata_0_1_o = m_tdata[0][1];
-assign m_tdata_0_2_o = m_tdata[0][2];
-assign m_tdata_0_3_o = m_tdata[0][3];
-assign m_tdata_0_4_o = m_tdata[0][4];
+// Line buffer skid buffer occupancy, sampled by the testbench coverage model.
+// Skid buffers are present only in the ASIC line buffer implementation;
+// otherwise, state is tied to zero by the UUT.
 
-assign m_tdata_1_0_o = m_tdata[1][0];
-assign m_tdata_1_1_o = m_tdata[1][1];
-assign m_tdata_1_2_o = m_tdata[1][2];
-assign m_tdata_1_3_o = m_tdata[1][3];
-assign m_tdata_1_4_o = m_tdata[1][4];
+logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]  lb_skid_vld;
+logic [conv_pkg::KERNEL_DIAMETER_N - 1:0]
+      [conv_pkg::LB_ASIC_GROUPS_PER_WORD_N - 1:0]
+                                           lb_skid_sel;
 
-assign m_tdata_2_0_o = m_tdata[2][0];
-assign m_tdata_2_1_o = m_tdata[2][1];
-assign m_tdata_2_2_o = m_tdata[2][2];
-assign m_tdata_2_3_o = m_tdata[2][3];
-assign m_tdata_2_4_o = m_tdata[2][4];
+assign tb_lb_skid_vld_o = lb_skid_vld;
 
-assign m_tdata_3_0_o = m_tdata[3][0];
-assign m_tdata_3_1_o = m_tdata[3][1];
-assign m_tdata_3_2_o = m_tdata[3][2];
-assign m_tdata_3_3_o = m_tdata[3][3];
-assign m_tdata_3_4_o = m_tdata[3][4];
+for (genvar i = 0; i < conv_pkg::KERNEL_DIAMETER_N; i++) begin: lb_skid_GEN
+
+enc #(.W(conv_pkg::LB_ASIC_GROUPS_PER_WORD_N)) u_enc_skid_sel (
+  .x_i    (lb_skid_sel[i])
+, .y_o    (tb_lb_skid_idx_o[i])
+);
 
-assign m_tdata_4_0_o = m_tdata[4][0];
-assign m_tdata_4_1_o = m_tdata[4][1];
-assign m_tdata_4_2_o = m_tdata[4][2];
-assign m_tdata_4_3_o = m_tdata[4][3];
-assign m_tdata_4_4_o = m_tdata[4][4];
+end: lb_skid_GEN
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -177,5 +180,10 @@ assign m_tdata_4_4_o = m_tdata[4][4];
 
 assign cfg_target_o = cfg_pkg::TARGET;
 assign cfg_extend_strategy_o = cfg_pkg::EXTEND_STRATEGY;
+assign cfg_ppc_o = conv_pkg::PPC;
+assign cfg_kernel_diameter_o = conv_pkg::KERNEL_DIAMETER_N;
+assign cfg_channel_n_o = conv_pkg::CHANNEL_N;
+assign cfg_output_mode_o = cfg_pkg::OUTPUT_MODE;
+assign cfg_filter_impl_o = cfg_pkg::FILTER_IMPL;
 
 endmodule: tb`TB_CFG__SUFFIX
@@ -28,6 +28,8 @@
 `include "common_defs.svh"
 `include "seqgen_pkg.svh"
 `include "flops.svh"
+`include "cfg_pkg.svh"
+`include "tb_pkg.svh"
 
 // Well known interview question to design a small controller to emit
 // the following sequence.
@@ -62,7 +64,25 @@
 //
 //   https://github.com/comestime/RTL4Interview/Seq_Gen
 //
-
+// Throughput:
+//
+// Up to cfg_pkg::LANES consecutive coordinates of the sequence are emitted
+// per cycle. The controller and coordinate datapath are replicated per lane,
+// where each lane advances the sequence by a single coordinate from the
+// state computed by the prior lane. Lanes are qualified by coord_vld_o; the
+// final cycle of a sequence may be partially populated.
+//
+// Descriptors:
+//
+// Each assertion of start_i (whilst ready_o) enqueues a descriptor (w_i,
+// h_i). Up to cfg_pkg::QUEUE_N descriptors are queued behind the sequence in
+// progress, which on completion is succeeded by the next without reset or
+// bubble: the first coordinate of the next sequence is emitted on the lane
+// following the final coordinate of its predecessor. At most one sequence is
+// handed-off per cycle, such that sequences of fewer than cfg_pkg::LANES
+// coordinates may incur a partial cycle bubble. done_o is pulsed once per
+// descriptor, on the lane following its final coordinate.
+//
 
 module seqgen (
 
@@ -77,17 +97,20 @@ module seqgen (
 , input wire seqgen_pkg::coord_t            w_i
 , input wire seqgen_pkg::coord_t            h_i
 
+, output wire logic                         ready_o
+
 // -------------------------------------------------------------------------- //
 //                                                                            //
 // Outputs                                                                    //
 //                                                                            //
 // -------------------------------------------------------------------------- //
 
-, output wire seqgen_pkg::coord_t           coord_y_o
-, output wire seqgen_pkg::coord_t           coord_x_o
+, output wire seqgen_pkg::coord_group_t     coord_y_o
+, output wire seqgen_pkg::coord_group_t     coord_x_o
+, output wire logic [cfg_pkg::LANES - 1:0]  coord_vld_o
 
 , output wire logic                         busy_o
-, output wire logic                         done_o
+, output wire logic [cfg_pkg::LANES - 1:0]  done_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -105,27 +128,133 @@ module seqgen (
 //                                                                           //
 // ========================================================================= //
 
+localparam int LANES = cfg_pkg::LANES;
+localparam int QUEUE_N = cfg_pkg::QUEUE_N;
+
 // Control
 //
 `P_DFF(logic [1:0], pos, clk);
 `P_DFFR(logic, busy, 1'b0, clk, arst_n);
 `P_DFFR(logic, done, 1'b0, clk, arst_n);
 
+// Sequence state
+//
+`P_DFF(seqgen_pkg::coord_t, coord_x, clk);
+`P_DFF(seqgen_pkg::coord_t, coord_x_prior, clk);
+`P_DFF(seqgen_pkg::pos_t, coord_y, clk);
+
+// Descriptor of the sequence in progress.
+//
+`P_DFF(seqgen_pkg::desc_t, desc, clk);
+
+// Descriptor queue; entries are valid contiguously from the head (entry 0).
+// An incoming descriptor bypasses an empty queue.
+//
+`P_DFFR(logic [QUEUE_N - 1:0], queue_vld, '0, clk, arst_n);
+`P_DFF(seqgen_pkg::desc_t [QUEUE_N - 1:0], queue_desc, clk);
+
+logic                                   ready;
+logic                                   queue_push;
+logic                                   queue_pop;
+logic                                   queue_pushed;
+logic                                   head_vld;
+seqgen_pkg::desc_t                      head;
+logic                                   idle_start;
+
+// Sequence state presented to each lane; lane l advances the state at entry
+// l by a single coordinate to produce the state at entry (l + 1). Entry 0 is
+// the current state, entry LANES the next.
+//
+logic [LANES:0][1:0]                    lane_pos;
+logic [LANES:0]                         lane_busy;
+logic [LANES:0]                         lane_done;
+seqgen_pkg::coord_t [LANES:0]           lane_coord_x;
+seqgen_pkg::coord_t [LANES:0]           lane_coord_x_prior;
+seqgen_pkg::pos_t [LANES:0]             lane_coord_y;
+seqgen_pkg::desc_t [LANES:0]            lane_desc;
+
+// Head descriptor has been taken by a lane prior to entry l.
+logic [LANES:0]                         lane_taken;
+
+// Output flops
+//
+`P_DFF(seqgen_pkg::coord_group_t, coord_x_out, clk);
+`P_DFF(seqgen_pkg::pos_group_t, coord_y_out, clk);
+`P_DFF(logic [LANES - 1:0], coord_y_lsb_out, clk);
+`P_DFFR(logic [LANES - 1:0], coord_vld_out, '0, clk, arst_n);
+`P_DFFR(logic [LANES - 1:0], done_out, '0, clk, arst_n);
+
+// ========================================================================= //
+//                                                                           //
+// Logic                                                                     //
+//                                                                           //
+// ========================================================================= //
+
+`TB_STATIC_ASSERT((LANES == 1) || (LANES == 2) || (LANES == 4),
+  "Unsupported LANES in seqgen.sv")
+
+assign lane_pos[0] = pos_r;
+assign lane_busy[0] = busy_r;
+assign lane_done[0] = done_r;
+assign lane_coord_x[0] = coord_x_r;
+assign lane_coord_x_prior[0] = coord_x_prior_r;
+assign lane_coord_y[0] = coord_y_r;
+assign lane_desc[0] = desc_r;
+assign lane_taken[0] = 1'b0;
+
+// ------------------------------------------------------------------------- //
+// Descriptor queue
+
+assign ready = ~queue_vld_r[QUEUE_N - 1];
+
+assign head_vld = queue_vld_r[0] | start_i;
+assign head = queue_vld_r[0] ? queue_desc_r[0] : '{w: w_i, h: h_i};
+
+// An idle controller is started from the first lane.
+assign idle_start = ~busy_r & head_vld;
+
+// Head is popped when taken; the incoming descriptor is otherwise enqueued,
+// unless taken directly.
+assign queue_pop = lane_taken[LANES] & queue_vld_r[0];
+assign queue_push = start_i & ready & ~(lane_taken[LANES] & ~queue_vld_r[0]);
+
+always_comb begin: queue_PROC
+  queue_vld_w = queue_vld_r;
+  queue_desc_w = queue_desc_r;
+  queue_pushed = 1'b0;
+
+  if (queue_pop) begin
+    queue_vld_w = queue_vld_r >> 1;
+    queue_desc_w = queue_desc_r >> $bits(seqgen_pkg::desc_t);
+  end
+
+  // Enqueue at the first vacant entry.
+  for (int i = 0; i < QUEUE_N; i++) begin
+    if (queue_push && !queue_pushed && !queue_vld_w[i]) begin
+      queue_vld_w[i] = 1'b1;
+      queue_desc_w[i] = '{w: w_i, h: h_i};
+      queue_pushed = 1'b1;
+    end
+  end
+end: queue_PROC
+
+// ------------------------------------------------------------------------- //
+// Lanes
+
+for (genvar l = 0; l < LANES; l++) begin: lane_GEN
+
+logic                                   lane_start;
+logic                                   lane_fin;
+
 logic                                   is_first_x;
 logic                                   is_last_x;
 
 logic                                   is_first_y;
 logic                                   is_last_y;
 
-// Output flops
-//
 logic                                   coord_x_clr;
 logic                                   coord_x_inc;
 seqgen_pkg::coord_t                     coord_x_inc_out;
-`P_DFF(seqgen_pkg::coord_t, coord_x, clk);
-`P_DFF(seqgen_pkg::coord_t, coord_x_prior, clk);
-`P_DFF(seqgen_pkg::coord_t, coord_x_out, clk);
-
 seqgen_pkg::coord_t [2:0]               coord_x;
 logic [2:0]                             coord_x_sel;
 
@@ -134,41 +263,45 @@ logic [1:0]                             coord_y_sel;
 logic                                   coord_y_clr;
 logic                                   coord_y_inc;
 seqgen_pkg::pos_t                       coord_y_inc_out;
-`P_DFF(seqgen_pkg::pos_t, coord_y, clk);
-`P_DFF(seqgen_pkg::pos_t, coord_y_out, clk);
 
 // Tie-offs
 logic                                   coord_x_co;
 logic                                   coord_y_co;
 
+// The sequence completes on the lane which steps beyond its final coordinate
+// (D -> Done); the lane instead starts the next sequence, if any, unless one
+// has already been started on this cycle.
+assign lane_fin =
+  lane_busy[l] & (lane_pos[l] == 2'b11) & is_last_x & is_last_y;
 
-// ========================================================================= //
-//                                                                           //
-// Logic                                                                     //
-//                                                                           //
-// ========================================================================= //
+assign lane_start =
+    ((l == 0) ? idle_start : 1'b0)
+  | (lane_fin & head_vld & ~lane_taken[l]);
+
+assign lane_taken[l + 1] = lane_taken[l] | lane_start;
+assign lane_desc[l + 1] = lane_start ? head : lane_desc[l];
 
 // Controller
 
-generate case (cfg_pkg::IMPL)
+case (cfg_pkg::IMPL)
 
   "pla": begin: cntrl_pla_GEN
     seqgen_cntrl_pla u_cntrl (
     //
-      .start_i              (start_i)
+      .start_i              (lane_start)
     //
-    , .busy_r_i             (busy_r)
-    , .done_r_i             (done_r)
-    , .pos_r_i              (pos_r)
+    , .busy_r_i             (lane_busy[l])
+    , .done_r_i             (lane_done[l])
+    , .pos_r_i              (lane_pos[l])
     //
     , .is_first_x_i         (is_first_x)
     , .is_last_x_i          (is_last_x)
     , .is_first_y_i         (is_first_y)
     , .is_last_y_i          (is_last_y)
     //
-    , .busy_w_o             (busy_w)
-    , .done_w_o             (done_w)
-    , .pos_w_o              (pos_w)
+    , .busy_w_o             (lane_busy[l + 1])
+    , .done_w_o             (lane_done[l + 1])
+    , .pos_w_o              (lane_pos[l + 1])
     //
     , .coord_x_clr_o        (coord_x_clr)
     , .coord_x_inc_o        (coord_x_inc)
@@ -182,20 +315,20 @@ generate case (cfg_pkg::IMPL)
   "case": begin: cntrl_case_GEN
     seqgen_cntrl_case u_cntrl (
     //
-      .start_i              (start_i)
+      .start_i              (lane_start)
     //
-    , .busy_r_i             (busy_r)
-    , .done_r_i             (done_r)
-    , .pos_r_i              (pos_r)
+    , .busy_r_i             (lane_busy[l])
+    , .done_r_i             (lane_done[l])
+    , .pos_r_i              (lane_pos[l])
     //
     , .is_first_x_i         (is_first_x)
     , .is_last_x_i          (is_last_x)
     , .is_first_y_i         (is_first_y)
     , .is_last_y_i          (is_last_y)
     //
-    , .busy_w_o             (busy_w)
-    , .done_w_o             (done_w)
-    , .pos_w_o              (pos_w)
+    , .busy_w_o             (lane_busy[l + 1])
+    , .done_w_o             (lane_done[l + 1])
+    , .pos_w_o              (lane_pos[l + 1])
     //
     , .coord_x_clr_o        (coord_x_clr)
     , .coord_x_inc_o        (coord_x_inc)
@@ -206,23 +339,23 @@ generate case (cfg_pkg::IMPL)
     );
   end: cntrl_case_GEN
 
-  "fsm": begin: cntrl_case_GEN
+  "fsm": begin: cntrl_fsm_GEN
     seqgen_cntrl_fsm u_cntrl (
     //
-      .start_i              (start_i)
+      .start_i              (lane_start)
     //
-    , .busy_r_i             (busy_r)
-    , .done_r_i             (done_r)
-    , .pos_r_i              (pos_r)
+    , .busy_r_i             (lane_busy[l])
+    , .done_r_i             (lane_done[l])
+    , .pos_r_i              (lane_pos[l])
     //
     , .is_first_x_i         (is_first_x)
     , .is_last_x_i          (is_last_x)
     , .is_first_y_i         (is_first_y)
     , .is_last_y_i          (is_last_y)
     //
-    , .busy_w_o             (busy_w)
-    , .done_w_o             (done_w)
-    , .pos_w_o              (pos_w)
+    , .busy_w_o             (lane_busy[l + 1])
+    , .done_w_o             (lane_done[l + 1])
+    , .pos_w_o              (lane_pos[l + 1])
     //
     , .coord_x_clr_o        (coord_x_clr)
     , .coord_x_inc_o        (coord_x_inc)
@@ -230,55 +363,74 @@ generate case (cfg_pkg::IMPL)
     , .coord_y_clr_o        (coord_y_clr)
     , .coord_y_inc_o        (coord_y_inc)
     , .coord_y_sel_o        (coord_y_sel)
-    //
-    , .clk                  (clk)
-    , .arst_n               (arst_n)
     );
-  end: cntrl_case_GEN
+  end: cntrl_fsm_GEN
 
-  default: begin
+  default: begin: cntrl_default_GEN
 
-  end
+  `TB_ERROR("Unsupported IMPL in seqgen.sv");
+
+  end: cntrl_default_GEN
 
 endcase
-endgenerate
 
 // X-axis
 
 inc #(.W(cfg_pkg::COORD_W)) u_inc_x (
-  .x_i(coord_x_r), .y_o(coord_x_inc_out), .carry_o(coord_x_co));
+  .x_i(lane_coord_x[l]), .y_o(coord_x_inc_out), .carry_o(coord_x_co));
 
-assign coord_x_w = coord_x_clr ? '0 : (coord_x_inc ? coord_x_inc_out : coord_x_r);
+assign lane_coord_x[l + 1] =
+  coord_x_clr ? '0 : (coord_x_inc ? coord_x_inc_out : lane_coord_x[l]);
 
-assign coord_x_prior_w = coord_x_inc ? coord_x_r : coord_x_prior_r;
+assign lane_coord_x_prior[l + 1] =
+  coord_x_inc ? lane_coord_x[l] : lane_coord_x_prior[l];
 
-assign coord_x[2] = coord_x_prior_r;
+assign coord_x[2] = lane_coord_x_prior[l];
 assign coord_x[1] = coord_x_inc_out;
-assign coord_x[0] = coord_x_r;
+assign coord_x[0] = lane_coord_x[l];
 
 mux #(.N(3), .W(cfg_pkg::COORD_W)) u_mux_coord_x (
-  .x_i(coord_x), .sel_i(coord_x_sel), .y_o(coord_x_out_w));
+  .x_i(coord_x), .sel_i(coord_x_sel), .y_o(coord_x_out_w[l]));
 
 // Y-axis
 
 inc #(.W(seqgen_pkg::POS_W)) u_inc_y (
-  .x_i(coord_y_r), .y_o(coord_y_inc_out), .carry_o(coord_y_co));
+  .x_i(lane_coord_y[l]), .y_o(coord_y_inc_out), .carry_o(coord_y_co));
 
-assign coord_y_w = coord_y_clr ? '0 : (coord_y_inc ? coord_y_inc_out : coord_y_r);
+assign lane_coord_y[l + 1] =
+  coord_y_clr ? '0 : (coord_y_inc ? coord_y_inc_out : lane_coord_y[l]);
 
 assign coord_y[1] = coord_y_inc_out;
-assign coord_y[0] = coord_y_r;
+assign coord_y[0] = lane_coord_y[l];
 
 mux #(.N(2), .W(seqgen_pkg::POS_W)) u_mux_coord_y (
-  .x_i(coord_y), .sel_i(coord_y_sel), .y_o(coord_y_out_w));
+  .x_i(coord_y), .sel_i(coord_y_sel), .y_o(coord_y_out_w[l]));
 
 // Position
 
-assign is_first_x = (coord_x_r == '0);
-assign is_last_x = (coord_x_r == w_i);
+assign is_first_x = (lane_coord_x[l] == '0);
+assign is_last_x = (lane_coord_x[l] == lane_desc[l].w);
+
+assign is_first_y = (lane_coord_y[l] == '0);
+assign is_last_y = ({lane_coord_y[l], 1'b1} == lane_desc[l].h);
+
+// Coordinate emitted by the lane; valid whenever the sequence remains busy.
+assign coord_y_lsb_out_w[l] = lane_pos[l + 1][0];
+assign coord_vld_out_w[l] = lane_busy[l + 1];
+assign done_out_w[l] = lane_fin;
+
+logic UNUSED__tie_off;
+assign UNUSED__tie_off = |{ coord_x_co, coord_y_co };
+
+end: lane_GEN
 
-assign is_first_y = (coord_y_r == '0);
-assign is_last_y = ({coord_y_r, 1'b1} == h_i);
+assign pos_w = lane_pos[LANES];
+assign busy_w = lane_busy[LANES];
+assign done_w = lane_done[LANES];
+assign coord_x_w = lane_coord_x[LANES];
+assign coord_x_prior_w = lane_coord_x_prior[LANES];
+assign coord_y_w = lane_coord_y[LANES];
+assign desc_w = lane_desc[LANES];
 
 // ========================================================================= //
 //                                                                           //
@@ -286,20 +438,18 @@ assign is_last_y = ({coord_y_r, 1'b1} == h_i);
 //                                                                           //
 // ========================================================================= //
 
-assign coord_y_o = {coord_y_out_r, pos_r[0]};
-assign coord_x_o = coord_x_out_r;
+for (genvar l = 0; l < LANES; l++) begin: coord_out_GEN
 
-assign busy_o = busy_r;
-assign done_o = done_r;
+assign coord_y_o[l] = {coord_y_out_r[l], coord_y_lsb_out_r[l]};
+assign coord_x_o[l] = coord_x_out_r[l];
 
-// ========================================================================= //
-//                                                                           //
-// UNUSED                                                                    //
-//                                                                           //
-// ========================================================================= //
+end: coord_out_GEN
 
-logic UNUSED__tie_off;
-assign UNUSED__tie_off = |{ coord_x_co, coord_y_co };
+assign coord_vld_o = coord_vld_out_r;
+
+assign ready_o = ready;
+assign busy_o = busy_r;
+assign done_o = done_out_r;
 
 endmodule: seqgen
 
@@ -26,7 +26,11 @@
 //========================================================================== //
 
 `include "common_defs.svh"
-`include "flops.svh"
+
+// Controller expressed as a conventional state machine. State is encoded in
+// (and held by) the busy, done and pos registers of seqgen, such that the
+// controller is purely combinational and may be replicated per lane. See
+// seqgen_cntrl_case for the corresponding transition diagrams.
 
 module seqgen_cntrl_fsm (
 // -------------------------------------------------------------------------- //
@@ -69,15 +73,6 @@ module seqgen_cntrl_fsm (
 , output wire logic                         coord_x_clr_o
 , output wire logic                         coord_x_inc_o
 , output wire logic [2:0]                   coord_x_sel_o
-
-// -------------------------------------------------------------------------- //
-//                                                                            //
-// Misc.                                                                      //
-//                                                                            //
-// -------------------------------------------------------------------------- //
-
-, input wire logic                           clk
-, input wire logic                           arst_n
 );
 
 
@@ -87,17 +82,27 @@ module seqgen_cntrl_fsm (
 //                                                                           //
 // ========================================================================= //
 
+// State encoding: {busy, done, pos}.
 typedef enum logic [3:0] {
-    S_IDLE = 'b0000,
-    S_DONE = 'b1111
+    // Idle; awaiting start.
+    S_IDLE = 'b00_00,
+
+    // A: upper row of the current row pair.
+    S_A    = 'b10_00,
+
+    // E: lower row, trailing A by one column.
+    S_E    = 'b10_01,
+
+    // C/D: lower row, final column.
+    S_D    = 'b10_11,
+
+    // Sequence complete.
+    S_DONE = 'b01_00
 } state_t;
 
-state_t                                state_next;
-`P_DFF(state_t, state, clk);
+state_t                                state_r;
+state_t                                state_w;
 
-logic                                  busy_w;
-logic                                  done_w;
-logic [1:0]                            pos_w;
 logic                                  coord_y_clr;
 logic                                  coord_y_inc;
 logic [1:0]                            coord_y_sel;
@@ -111,38 +116,88 @@ logic [2:0]                            coord_x_sel;
 //                                                                           //
 // ========================================================================= //
 
+assign state_r = state_t'({busy_r_i, done_r_i, pos_r_i});
+
 always_comb begin: next_state_PROC
 
   // Defaults:
-  pos_w = 'b0;
+  state_w = state_r;
   coord_y_clr = 'b0;
   coord_y_inc = 'b0;
   coord_y_sel = 'b00;
   coord_x_clr = 'b0;
   coord_x_inc = 'b0;
   coord_x_sel = 'b000;
-  busy_w = 'b0;
-  done_w = 'b0;
 
   // State update override on start_i.
-  state_next = start_i ? S_IDLE : state_r;
-
-  case (state_next) inside
-
-    S_IDLE: begin
-
-    end
-
-    S_DONE: begin
-        done_w = 1'b1;
+  if (start_i) begin
+    // Idle -> A; emit (0, 0).
+    state_w = S_A;
+    coord_y_clr = 'b1;
+    coord_x_clr = 'b1;
+  end else begin
+
+    case (state_r) inside
+
+      S_A: begin
+        // Retain Y.
+        coord_y_sel = 'b01;
+        if (!is_first_x_i) begin
+          // A -> E; emit prior X.
+          state_w = S_E;
+          coord_x_sel = 'b100;
+        end else if (is_last_x_i) begin
+          // A -> C; emit current X.
+          state_w = S_D;
+          coord_x_sel = 'b001;
+        end else begin
+          // A -> B; emit next X.
+          state_w = S_A;
+          coord_x_inc = 'b1;
+          coord_x_sel = 'b010;
+        end
+      end
+
+      S_E: begin
+        // Retain Y.
+        coord_y_sel = 'b01;
+        if (!is_last_x_i) begin
+          // E -> B; emit next X.
+          state_w = S_A;
+          coord_x_inc = 'b1;
+          coord_x_sel = 'b010;
+        end else begin
+          // C -> D; emit current X.
+          state_w = S_D;
+          coord_x_sel = 'b001;
+        end
+      end
+
+      S_D: begin
+        if (!is_last_y_i) begin
+          // D -> A'; emit (next Y, 0).
+          state_w = S_A;
+          coord_y_inc = 'b1;
+          coord_y_sel = 'b10;
+          coord_x_clr = 'b1;
+        end else begin
+          // D -> Done
+          state_w = S_DONE;
+        end
+      end
+
+      S_DONE: begin
         state_w = S_DONE;
-    end
+      end
 
-    default: begin
+      default: begin
+        // Idle; remain until start.
+        state_w = S_IDLE;
+      end
 
-    end
+    endcase
 
-  endcase
+  end
 
 end: next_state_PROC
 
@@ -152,9 +207,7 @@ end: next_state_PROC
 //                                                                           //
 // ========================================================================= //
 
-assign busy_w_o = busy_w;
-assign done_w_o = done_w;
-assign pos_w_o = pos_w;
+assign {busy_w_o, done_w_o, pos_w_o} = state_w;
 assign coord_y_clr_o = coord_y_clr;
 assign coord_y_inc_o = coord_y_inc;
 assign coord_y_sel_o = coord_y_sel;
@@ -162,8 +215,13 @@ assign coord_x_clr_o = coord_x_clr;
 assign coord_x_inc_o = coord_x_inc;
 assign coord_x_sel_o = coord_x_sel; 
 
-endmodule: seqgen_cntrl_fsm
+// ========================================================================= //
+//                                                                           //
+// UNUSED                                                                    //
+//                                                                           //
+// ========================================================================= //
 
-`define FLOPS_UNDEF
-`include "flops.svh"
-`undef FLOPS_UNDEF
+logic UNUSED__is_first_y;
+assign UNUSED__is_first_y = is_first_y_i;
+
+endmodule: seqgen_cntrl_fsm
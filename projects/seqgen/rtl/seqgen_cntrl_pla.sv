@@ -72,6 +72,8 @@ module seqgen_cntrl_pla (
 
 //! PLA_BEGIN
 //!
+//! .opt depth
+//!
 //! .i start_i pos_r_i[1:0] is_first_x_i is_last_x_i is_first_y_i \
 //!     is_last_y_i busy_r_i done_r_i
 //!
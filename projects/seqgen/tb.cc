@@ -28,12 +28,19 @@
 #include "tb/tb.h"
 
 #include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
+#include "tb/args.h"
 #include "tb/project.h"
-#include "v/Vtb_seqgen_case.h"
-#include "v/Vtb_seqgen_fsm.h"
-#include "v/Vtb_seqgen_pla.h"
+#include "tb/sched.h"
+#include "tb/vsupport.h"
+
+// instances of the configuration matrix, with their configurations
+// (rendered by generate_project)
+#include "matrix/seqgen.h"
 
 namespace {
 
@@ -43,11 +50,34 @@ struct TestCase {
   std::size_t coord_x;
 };
 
+// Cycles allowed for a testcase to be accepted, or to complete once started.
+constexpr std::size_t TIMEOUT_CYCLES_N = 1000;
+
+// Cycles run following completion of the final testcase.
+constexpr std::size_t COOL_DOWN_CYCLES_N = 10;
+
 struct Coord {
   std::size_t coord_y;
   std::size_t coord_x;
+
+  bool operator==(const Coord&) const = default;
 };
 
+// Reference sequence for a frame of (h, w); rows are visited in pairs, where
+// each pair is traversed diagonally (see seqgen.sv).
+std::vector<Coord> reference_sequence(std::size_t h, std::size_t w) {
+  std::vector<Coord> seq;
+  for (std::size_t y = 0; y < h; y += 2) {
+    seq.push_back(Coord{y, 0});
+    for (std::size_t x = 1; x < w; ++x) {
+      seq.push_back(Coord{y, x});
+      seq.push_back(Coord{y + 1, x - 1});
+    }
+    seq.push_back(Coord{y + 1, w - 1});
+  }
+  return seq;
+}
+
 template <typename T>
 concept VSeqGenModule = requires(T t) {
   // Module evaluation method
@@ -57,12 +87,17 @@ concept VSeqGenModule = requires(T t) {
   t.start_i;
   t.w_i;
   t.h_i;
+  t.ready_o;
 
   t.coord_y_o;
   t.coord_x_o;
+  t.coord_vld_o;
   t.busy_o;
   t.done_o;
 
+  // Module parameterizations
+  t.cfg_lanes_o;
+
   // Generic synchronous ports
   t.clk;
   t.arst_n;
@@ -109,71 +144,128 @@ class SeqGenTestCasesBase : public tb::GenericSynchronousTest {
   std::vector<TestCase> test_cases_;
 };
 
-template <VSeqGenModule UUT>
+// Testbench of an instance; Cfg is the rendered configuration of the
+// instance (see cfg/<instance>.h).
+template <VSeqGenModule UUT, typename Cfg>
 class SeqGenTestbench final : public tb::GenericSynchronousProjectInstance<UUT>,
                               public SeqGenTestbenchInterface {
  public:
   using base_type = tb::GenericSynchronousProjectInstance<UUT>;
 
+  // Coordinates emitted per cycle (see cfg_pkg::LANES).
+  static constexpr std::size_t LANES = Cfg::LANES;
+
+  // Coordinate width in bits (see cfg_pkg::COORD_W).
+  static constexpr std::size_t COORD_W = Cfg::COORD_W;
+
   explicit SeqGenTestbench()
       : tb::GenericSynchronousProjectInstance<UUT>("SeqGenTestbench") {}
 
   virtual ~SeqGenTestbench() = default;
 
   void run(tb::ProjectTestBase* test) override {
+    // Testcases are issued back-to-back following a single reset; each is
+    // enqueued as soon as the UUT is ready to accept it.
+    std::vector<TestCase> tcs;
     while (!testcase_done()) {
-      // Next testcase
-      const TestCase& tc{testcase_next()};
-
-      // Run testcase
-      run_testcase(tc);
-
-      // Discard test
+      tcs.push_back(testcase_next());
       testcase_pop();
     }
-  }
 
- private:
-  void run_testcase(const TestCase& tc) {
     // Reset instance
     this->perform_reset_sequence();
 
-    // Start test
-    start(true);
-    last(tc);
-    this->step_cycles_n(1);
-    start(false);
+    // Stimulus and response run as concurrent sequences.
+    tb::sched::Scheduler sched;
+    sched.spawn(drive(sched, tcs));
+    sched.spawn(collect(sched, tcs));
+    sched.run([this](std::size_t n) { this->step_cycles_n(n); });
 
-    std::size_t timeout_cycles = 1000;
-    std::vector<Coord> actual;
-    while (!done()) {
-      if (!busy()) {
-        // Expect busy to be asserted
-      }
+    // Test complete!
+  }
 
-      if (actual.size()) {
-        // Busy never reached.
+ private:
+  // Enqueue each testcase in turn, once the UUT is ready.
+  tb::sched::Task drive(
+    tb::sched::Scheduler& sched, std::vector<TestCase> tcs) {
+    for (const TestCase& tc : tcs) {
+      if (!co_await sched.until([this] { return ready(); },
+                                TIMEOUT_CYCLES_N)) {
+        throw std::runtime_error("Timeout awaiting ready: " + tc.name);
       }
 
-      actual.push_back(coord());
-      this->step_cycles_n(1);
+      start(true);
+      last(tc);
+      co_await sched.negedge();
+    }
+    start(false);
+  }
 
-      if (--timeout_cycles == 0) break;
+  // Collect the emitted sequences and check each against its reference.
+  // Lanes preceding a done pulse belong to the completing sequence, those
+  // from it onwards to its successor. A successor must follow without
+  // bubble, unless the completing sequence was too short to cover the
+  // hand-off (see seqgen.sv).
+  tb::sched::Task collect(
+    tb::sched::Scheduler& sched, std::vector<TestCase> tcs) {
+    const std::size_t lanes = this->uut()->cfg_lanes_o;
+    if (lanes != LANES) {
+      throw std::runtime_error("Lane count differs from the configuration.");
     }
 
-    // Cool-down period.
-    for (std::size_t i = 0; i < 10; i++) {
-      if (!done()) {
-        // Expect done to remain asserted.
+    std::vector<Coord> actual;
+    std::size_t i = 0;
+    std::size_t gap_n = 0;
+    bool gap_allowed = true;
+    std::size_t idle_cycles_n = 0;
+    while (i < tcs.size()) {
+      co_await sched.negedge();
+
+      if (++idle_cycles_n > TIMEOUT_CYCLES_N) {
+        throw std::runtime_error(
+          "Timeout awaiting completion: " + tcs[i].name);
       }
 
-      if (busy()) {
-        // Expect busy to be deasserted.
+      for (std::size_t l = 0; l < lanes; ++l) {
+        if (i < tcs.size() && done(l)) {
+          const TestCase& tc{tcs[i]};
+          if (actual != reference_sequence(tc.coord_y, tc.coord_x)) {
+            throw std::runtime_error(
+              "Sequence mismatch against reference: " + tc.name);
+          }
+          gap_allowed = (actual.size() < lanes);
+          gap_n = 0;
+          actual.clear();
+          idle_cycles_n = 0;
+          ++i;
+        }
+
+        if (!coord_vld(l)) {
+          ++gap_n;
+          continue;
+        }
+
+        if (i == tcs.size()) {
+          throw std::runtime_error("Unexpected coordinate following final "
+                                   "testcase: " + tcs.back().name);
+        }
+        if (actual.empty() && (i != 0) && (gap_n != 0) && !gap_allowed) {
+          throw std::runtime_error("Bubble preceding testcase: " +
+                                   tcs[i].name);
+        }
+        actual.push_back(coord(l));
       }
-      this->step_cycles_n();
     }
 
-    // Test complete!
+    // Cool-down period; the UUT must remain idle.
+    for (std::size_t n = 0; n < COOL_DOWN_CYCLES_N; ++n) {
+      co_await sched.negedge();
+      for (std::size_t l = 0; l < lanes; ++l) {
+        if (coord_vld(l) || done(l)) {
+          throw std::runtime_error("Activity following final testcase");
+        }
+      }
+    }
   }
 
   void testcase_add(const TestCase& tc) override { test_cases_.push_back(tc); }
@@ -195,19 +287,31 @@ class SeqGenTestbench final : public tb::GenericSynchronousProjectInstance<UUT>,
     this->uut()->w_i = tc.coord_x;
     this->uut()->h_i = tc.coord_y;
   }
-  Coord coord() const noexcept {
+  bool coord_vld(std::size_t i) const noexcept {
+    return tb::vsupport::bits(this->uut()->coord_vld_o, i, 1);
+  }
+
+  // Coordinate emitted by lane i.
+  Coord coord(std::size_t i) const noexcept {
     Coord c{};
-    c.coord_y = static_cast<std::size_t>(this->uut()->coord_y_o);
-    c.coord_x = static_cast<std::size_t>(this->uut()->coord_x_o);
+    c.coord_y = tb::vsupport::bits(this->uut()->coord_y_o, i * COORD_W,
+      COORD_W);
+    c.coord_x = tb::vsupport::bits(this->uut()->coord_x_o, i * COORD_W,
+      COORD_W);
     return c;
   }
 
+  bool ready() const noexcept {
+    return tb::vsupport::from_v<bool>(this->uut()->ready_o);
+  }
+
   bool busy() const noexcept {
     return tb::vsupport::from_v<bool>(this->uut()->busy_o);
   }
 
-  bool done() const noexcept {
-    return tb::vsupport::from_v<bool>(this->uut()->done_o);
+  // Sequence completed on lane i.
+  bool done(std::size_t i) const noexcept {
+    return tb::vsupport::bits(this->uut()->done_o, i, 1);
   }
 
   std::size_t cycle() override {
@@ -250,6 +354,38 @@ class SeqGenTestCases final : public SeqGenTestCasesBase {
   std::vector<TestCase> test_cases_;
 };
 
+// Randomized descriptors, issued back-to-back. Arguments:
+//
+//   seed=<n>            Randomization seed.
+//   n=<n>               Number of descriptors; default: 64.
+//
+class SeqGenRandomChain final : public SeqGenTestCasesBase {
+  // Frame dimensions; heights are even.
+  static constexpr std::size_t H_MAX = 16;
+  static constexpr std::size_t W_MAX = 16;
+
+ public:
+  explicit SeqGenRandomChain(const std::string& args)
+      : SeqGenTestCasesBase(args) {
+    const tb::TestArgs targs(args);
+    if (targs.has("seed")) {
+      tb::RANDOM.seed(targs.get_or<tb::Random::seed_type>("seed", 0));
+    }
+
+    const std::size_t n = targs.get_or<std::size_t>("n", 64);
+    for (std::size_t i = 0; i < n; ++i) {
+      // Single column frames are restricted to a single row pair (see
+      // seqgen_cntrl_case.sv, A -> C).
+      const std::size_t w = tb::RANDOM.uniform<std::size_t>(W_MAX, 1);
+      const std::size_t h =
+        (w == 1) ? 2 : 2 * tb::RANDOM.uniform<std::size_t>(H_MAX / 2, 1);
+      add_testcase(TestCase{
+        std::to_string(i) + ":" + std::to_string(h) + "x" + std::to_string(w),
+        h, w});
+    }
+  }
+};
+
 }  // namespace
 
 namespace projects::seqgen {
@@ -257,16 +393,12 @@ namespace projects::seqgen {
 void register_project() {
   TB_PROJECT_CREATE(seqgen);
 
-  // Verilog case statement implementation
-  TB_PROJECT_ADD_INSTANCE(seqgen, cfg_case, SeqGenTestbench<Vtb_seqgen_case>);
-
-  // PLA implementation
-  TB_PROJECT_ADD_INSTANCE(seqgen, cfg_pla, SeqGenTestbench<Vtb_seqgen_pla>);
-
-  // FSM implementation
-  TB_PROJECT_ADD_INSTANCE(seqgen, cfg_fsm, SeqGenTestbench<Vtb_seqgen_fsm>);
+  // Instances of the configuration matrix, of each implementation and lane
+  // count (see CMakeLists.txt).
+  TB_PROJECT_ADD_MATRIX(seqgen, SeqGenTestbench);
 
   TB_PROJECT_ADD_TEST(seqgen, generic_tester, SeqGenTestCases);
+  TB_PROJECT_ADD_TEST(seqgen, random_chain, SeqGenRandomChain);
   TB_PROJECT_FINALIZE(seqgen);
 }
 
@@ -27,6 +27,7 @@
 
 `include "common_defs.svh"
 `include "seqgen_pkg.svh"
+`include "cfg_pkg.svh"
 
 // Filename does not match module name. Lint violation suppressed by
 // -Wno-DECLFILENAME flag.
@@ -43,17 +44,20 @@ module tb`TB_CFG__SUFFIX (
 , input wire seqgen_pkg::coord_t            w_i
 , input wire seqgen_pkg::coord_t            h_i
 
+, output wire logic                         ready_o
+
 // -------------------------------------------------------------------------- //
 //                                                                            //
 // Output                                                                     //
 //                                                                            //
 // -------------------------------------------------------------------------- //
 
-, output wire seqgen_pkg::coord_t           coord_y_o
-, output wire seqgen_pkg::coord_t           coord_x_o
+, output wire seqgen_pkg::coord_group_t     coord_y_o
+, output wire seqgen_pkg::coord_group_t     coord_x_o
+, output wire logic [cfg_pkg::LANES - 1:0]  coord_vld_o
 
 , output wire logic                         busy_o
-, output wire logic                         done_o
+, output wire logic [cfg_pkg::LANES - 1:0]  done_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -61,6 +65,7 @@ module tb`TB_CFG__SUFFIX (
 //                                                                            //
 // -------------------------------------------------------------------------- //
 
+, output wire int                           cfg_lanes_o
 
 // -------------------------------------------------------------------------- //
 //                                                                            //
@@ -98,8 +103,10 @@ seqgen uut (
   .start_i              (start_i)
 , .w_i                  (w_last)
 , .h_i                  (h_last)
+, .ready_o              (ready_o)
 , .coord_y_o            (coord_y_o)
 , .coord_x_o            (coord_x_o)
+, .coord_vld_o          (coord_vld_o)
 , .busy_o               (busy_o)
 , .done_o               (done_o)
 , .clk                  (clk)
@@ -112,4 +119,6 @@ seqgen uut (
 //                                                                            //
 // -------------------------------------------------------------------------- //
 
+assign cfg_lanes_o = cfg_pkg::LANES;
+
 endmodule: tb`TB_CFG__SUFFIX
@@ -0,0 +1,223 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import csv
+import math
+import os
+import re
+import statistics
+import subprocess
+import time
+import typing
+
+# Performance summary emitted by the driver on completion of a job (see
+# tb/src/runner.cc).
+PERF_RE = re.compile(
+    r'^Performance: cycles=(?P<cycles>\d+) wall=(?P<wall>[0-9.eE+-]+) '
+    r'cycles_per_sec=(?P<cycles_per_sec>[0-9.eE+-]+) '
+    r'rss_kb=(?P<rss_kb>\d+)$')
+
+
+def parse_performance(log: str) -> typing.Optional[dict]:
+    """Parse the performance summary from the log of a job, if present."""
+    with open(log, 'r', errors='replace') as f:
+        for line in f:
+            if m := PERF_RE.match(line.strip()):
+                return {
+                    'cycles': int(m['cycles']),
+                    'wall': float(m['wall']),
+                    'cycles_per_sec': float(m['cycles_per_sec']),
+                    'rss_kb': int(m['rss_kb']),
+                }
+    return None
+
+
+def current_revision(src_dir: str) -> str:
+    """Revision of the source tree; suffixed '-dirty' if modified."""
+    try:
+        cp = subprocess.run(
+            ['git', '-C', src_dir, 'describe', '--always', '--dirty'],
+            capture_output=True, text=True, check=True)
+        return cp.stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return 'unknown'
+
+
+class PerfStore:
+    # Append-only; one row per (passing) job per run.
+    FIELDS = ['revision', 'timestamp', 'project', 'instance', 'test', 'seed',
+              'cycles', 'wall', 'cycles_per_sec', 'rss_kb']
+
+    def __init__(self, store_file: str):
+        self._store_file = store_file
+
+    def append(self, revision: str, jobs: list[dict]) -> int:
+        """Record the performance of passing jobs; returns rows written."""
+        rows = list()
+        timestamp = int(time.time())
+        for job in jobs:
+            if job.get('status') != 'passed' or not job.get('perf'):
+                continue
+            rows.append({
+                'revision': revision,
+                'timestamp': timestamp,
+                'project': job['project'],
+                'instance': job['instance'],
+                'test': '.'.join(filter(None, [job['test'], job.get('tag')])),
+                'seed': '' if job['seed'] is None else job['seed'],
+                **job['perf'],
+            })
+
+        is_new = not os.path.exists(self._store_file)
+        with open(self._store_file, 'a', newline='') as f:
+            w = csv.DictWriter(f, fieldnames=self.FIELDS)
+            if is_new:
+                w.writeheader()
+            w.writerows(rows)
+        return len(rows)
+
+    def rows(self) -> list[dict]:
+        if not os.path.exists(self._store_file):
+            return list()
+        with open(self._store_file, 'r', newline='') as f:
+            return list(csv.DictReader(f))
+
+    def revisions(self) -> list[str]:
+        """Revisions recorded, in order of first appearance."""
+        return list(dict.fromkeys(row['revision'] for row in self.rows()))
+
+    def samples(self, revision: str) -> dict[tuple, list[dict]]:
+        """Rows of a revision, keyed by (project, instance, test)."""
+        samples = dict()
+        for row in self.rows():
+            if row['revision'] != revision:
+                continue
+            key = (row['project'], row['instance'], row['test'])
+            samples.setdefault(key, list()).append(row)
+        return samples
+
+
+class PerfComparator:
+    # Throughput (cycles/sec) of a candidate revision is compared against a
+    # baseline for each (project, instance, test), across all seeds and runs
+    # recorded. A slowdown is flagged when the median throughput falls by
+    # more than the threshold and the one-sided Mann-Whitney U test rejects
+    # (at alpha) the hypothesis that the candidate is no slower. The test is
+    # rank-based, hence insensitive to the outliers typical of shared hosts.
+
+    def __init__(self, store: PerfStore, threshold: float = 0.05,
+                 alpha: float = 0.05, min_samples: int = 3):
+        self._store = store
+        self._threshold = threshold
+        self._alpha = alpha
+        self._min_samples = min_samples
+
+    def compare(self, baseline: str, candidate: str) -> list[dict]:
+        base = self._store.samples(baseline)
+        cand = self._store.samples(candidate)
+        if not base:
+            raise ValueError(f'No samples recorded for baseline: {baseline}')
+        if not cand:
+            raise ValueError(f'No samples recorded for candidate: {candidate}')
+
+        results = list()
+        for key in sorted(base.keys() & cand.keys()):
+            a = [float(r['cycles_per_sec']) for r in base[key]]
+            b = [float(r['cycles_per_sec']) for r in cand[key]]
+            a_med, b_med = statistics.median(a), statistics.median(b)
+            change = (b_med - a_med) / a_med if a_med > 0 else 0.0
+            rss_a = statistics.median(int(r['rss_kb']) for r in base[key])
+            rss_b = statistics.median(int(r['rss_kb']) for r in cand[key])
+
+            if min(len(a), len(b)) < self._min_samples:
+                p, status = None, 'insufficient'
+            else:
+                p = self.mann_whitney_less(a, b)
+                if (p < self._alpha) and (change < -self._threshold):
+                    status = 'slower'
+                elif (change > self._threshold) and \
+                        (self.mann_whitney_less(b, a) < self._alpha):
+                    status = 'faster'
+                else:
+                    status = 'unchanged'
+
+            results.append({
+                'name': '.'.join(key),
+                'baseline': a_med,
+                'candidate': b_med,
+                'change': change,
+                'rss_change': (rss_b - rss_a) / rss_a if rss_a > 0 else 0.0,
+                'p': p,
+                'samples': (len(a), len(b)),
+                'status': status,
+            })
+        return results
+
+    @staticmethod
+    def mann_whitney_less(a: list[float], b: list[float]) -> float:
+        """One-sided p-value of samples b being stochastically less than a;
+        normal approximation with continuity and tie corrections."""
+        n1, n2 = len(a), len(b)
+        ranked = sorted([(x, 0) for x in a] + [(x, 1) for x in b])
+
+        # Mid-ranks over ties.
+        ranks = [0.0] * len(ranked)
+        ties = 0.0
+        i = 0
+        while i < len(ranked):
+            j = i
+            while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+                j += 1
+            for k in range(i, j + 1):
+                ranks[k] = (i + j) / 2 + 1
+            t = j - i + 1
+            ties += t ** 3 - t
+            i = j + 1
+
+        # U counts pairs in which the element of a exceeds that of b.
+        r1 = sum(r for r, (_, g) in zip(ranks, ranked) if g == 0)
+        u = r1 - n1 * (n1 + 1) / 2
+
+        n = n1 + n2
+        mean = n1 * n2 / 2
+        var = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)))
+        if var <= 0:
+            return 1.0
+        z = (u - mean - 0.5) / math.sqrt(var)
+        return 0.5 * math.erfc(z / math.sqrt(2))
+
+    @staticmethod
+    def render(results: list[dict]) -> str:
+        lines = [f'{"name":<48} {"baseline":>12} {"candidate":>12} '
+                 f'{"change":>8} {"rss":>8} {"p":>7}  status']
+        for r in results:
+            p = '-' if r['p'] is None else f'{r["p"]:.3f}'
+            lines.append(
+                f'{r["name"]:<48} {r["baseline"]:>12.0f} '
+                f'{r["candidate"]:>12.0f} {r["change"]:>+8.1%} '
+                f'{r["rss_change"]:>+8.1%} {p:>7}  {r["status"]}')
+        return '\n'.join(lines)
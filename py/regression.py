@@ -0,0 +1,371 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import fnmatch
+import json
+import os
+import signal
+import subprocess
+import threading
+import time
+import typing
+import xml.etree.ElementTree as ET
+from concurrent.futures import ThreadPoolExecutor
+
+from performance import parse_performance
+
+
+class RegressionJob:
+    def __init__(self, project: str, instance: str, test: str,
+                 seed: typing.Optional[int], args: str,
+                 tag: typing.Optional[str] = None,
+                 flags: typing.Optional[list[str]] = None):
+        self.project = project
+        self.instance = instance
+        self.test = test
+        self.seed = seed
+        self.args = args
+        self.tag = tag
+        self.flags = flags or list()
+
+        self.status = 'pending'
+        self.returncode = None
+        self.runtime = 0.0
+        self.log = None
+        self.perf = None
+
+    @property
+    def name(self) -> str:
+        name = f'{self.project}.{self.instance}.{self.test}'
+        if self.tag:
+            name += f'.{self.tag}'
+        if self.seed is not None:
+            name += f'.{self.seed}'
+        return name
+
+    def test_args(self) -> str:
+        args = list()
+        if self.seed is not None:
+            args.append(f'seed={self.seed}')
+        if self.args:
+            args.append(self.args)
+        return ','.join(args)
+
+    def command(self, driver: str) -> list[str]:
+        # Driver flags (e.g. --strict-allocs <n>) precede the job selection.
+        cmd = [driver, *self.flags, '-p', self.project, '-i', self.instance,
+               '-t', self.test]
+        if args := self.test_args():
+            cmd.extend(['-a', args])
+        return cmd
+
+    def to_dict(self) -> dict:
+        return {
+            'name': self.name,
+            'project': self.project,
+            'instance': self.instance,
+            'test': self.test,
+            'tag': self.tag,
+            'seed': self.seed,
+            'args': self.test_args(),
+            'flags': self.flags,
+            'status': self.status,
+            'returncode': self.returncode,
+            'runtime': round(self.runtime, 3),
+            'log': self.log,
+            'perf': self.perf,
+        }
+
+
+def driver_instances(driver: str, project: str) -> list[str]:
+    # Instances of the project registered with the driver.
+    cp = subprocess.run([driver, '--list-instances', project],
+                        capture_output=True, text=True, check=True)
+    return cp.stdout.split()
+
+
+class RegressionManifest:
+    # Instances of an entry may be glob patterns (e.g. 'tb_conv_*', for the
+    # instances of a configuration matrix); they are expanded against the
+    # instances of the project, as returned by 'instances_of'.
+    def __init__(self, manifest_file: str,
+                 instances_of: typing.Optional[
+                     typing.Callable[[str], list[str]]] = None):
+        self._manifest = self._load_manifest(manifest_file)
+        self._instances_of = instances_of
+        self._instances = dict()
+
+    def _load_manifest(self, manifest_file: str) -> dict:
+        if not os.path.exists(manifest_file):
+            raise FileNotFoundError(
+                f"Manifest file not found: {manifest_file}")
+
+        import yaml
+        with open(manifest_file, 'r') as f:
+            manifest = yaml.safe_load(f)
+
+        if 'regression' not in manifest:
+            raise ValueError("Manifest file missing 'regression' section.")
+
+        return manifest
+
+    def jobs(self) -> list[RegressionJob]:
+        # Expand each entry as the product of its instances, tests and seeds.
+        defaults = self._manifest.get('defaults', dict())
+
+        jobs = list()
+        for entry in self._manifest['regression']:
+            for key in ['project', 'instances', 'tests']:
+                if key not in entry:
+                    raise ValueError(
+                        f"Regression entry missing '{key}': {entry}")
+
+            seeds = self._seeds(entry.get('seeds', defaults.get('seeds')))
+            args = entry.get('args', defaults.get('args', ''))
+            tag = entry.get('tag')
+            flags = [str(f) for f in entry.get('flags', list())]
+            for instance in self._expand_instances(
+                    entry['project'], entry['instances']):
+                for test in entry['tests']:
+                    for seed in seeds:
+                        jobs.append(RegressionJob(
+                            entry['project'], instance, test, seed, args,
+                            tag, flags))
+        return jobs
+
+    def _expand_instances(self, project: str,
+                          patterns: list[str]) -> list[str]:
+        instances = list()
+        for pattern in patterns:
+            if not any(c in pattern for c in '*?['):
+                instances.append(pattern)
+                continue
+            if self._instances_of is None:
+                raise ValueError(
+                    f"Instance pattern '{pattern}' requires the driver")
+            if project not in self._instances:
+                self._instances[project] = self._instances_of(project)
+            matches = fnmatch.filter(self._instances[project], pattern)
+            if not matches:
+                raise ValueError(
+                    f"Instance pattern '{pattern}' matches no instance of "
+                    f"project '{project}'")
+            instances.extend(matches)
+        return instances
+
+    def _seeds(self, seeds) -> list[typing.Optional[int]]:
+        # Seeds are either absent (a single, unseeded run), a list of seeds
+        # or an inclusive range {first: <n>, last: <n>}.
+        if seeds is None:
+            return [None]
+        if isinstance(seeds, list):
+            return [int(s) for s in seeds]
+        if isinstance(seeds, dict) and 'first' in seeds and 'last' in seeds:
+            return list(range(int(seeds['first']), int(seeds['last']) + 1))
+        raise ValueError(f"Malformed seeds: {seeds}")
+
+
+class RuntimeHistory:
+    # Runtimes of prior runs, keyed by job name, from which jobs are
+    # scheduled. The history is blended with each new observation such that
+    # it tracks (but is not unduly perturbed by) changes in runtime.
+    ALPHA = 0.5
+
+    def __init__(self, history_file: typing.Optional[str]):
+        self._history_file = history_file
+        self._runtimes = dict()
+        if history_file and os.path.exists(history_file):
+            with open(history_file, 'r') as f:
+                self._runtimes = json.load(f)
+
+    def estimate(self, job: RegressionJob) -> float:
+        # Jobs without history are assumed to be the longest.
+        return self._runtimes.get(job.name, float('inf'))
+
+    def update(self, job: RegressionJob) -> None:
+        if job.status != 'passed':
+            return
+        prior = self._runtimes.get(job.name)
+        if prior is None:
+            self._runtimes[job.name] = job.runtime
+        else:
+            self._runtimes[job.name] = \
+                self.ALPHA * job.runtime + (1 - self.ALPHA) * prior
+
+    def save(self) -> None:
+        if not self._history_file:
+            return
+        with open(self._history_file, 'w') as f:
+            json.dump(self._runtimes, f, indent=2, sort_keys=True)
+            f.write('\n')
+
+
+class RegressionRunner:
+    def __init__(self, driver: str, out_dir: str, workers: int,
+                 history: RuntimeHistory,
+                 timeout: typing.Optional[float] = None):
+        self._driver = driver
+        self._out_dir = out_dir
+        self._workers = workers
+        self._history = history
+        self._timeout = timeout
+        self._lock = threading.Lock()
+
+        self._log_dir = os.path.join(self._out_dir, 'logs')
+        if not os.path.exists(self._log_dir):
+            os.makedirs(self._log_dir)
+
+    def run(self, jobs: list[RegressionJob]) -> dict:
+        # Longest-first (LPT) scheduling: with jobs dispatched in order of
+        # decreasing estimated runtime, the regression completes in close to
+        # the time of its longest job given sufficient workers.
+        jobs = sorted(jobs, key=self._history.estimate, reverse=True)
+
+        print(f"Running {len(jobs)} jobs on {self._workers} workers...")
+        start = time.monotonic()
+        with ThreadPoolExecutor(max_workers=self._workers) as pool:
+            for _ in pool.map(self._run_job, jobs):
+                pass
+        wall = time.monotonic() - start
+
+        self._history.save()
+        return self._summarize(jobs, wall)
+
+    def _run_job(self, job: RegressionJob) -> None:
+        # Each job is run in its own driver process, such that a crash is
+        # isolated to (and reported against) the job alone.
+        job.log = os.path.join(self._log_dir, f'{job.name}.log')
+        start = time.monotonic()
+        with open(job.log, 'w') as log:
+            try:
+                cp = subprocess.run(job.command(self._driver), stdout=log,
+                                    stderr=subprocess.STDOUT,
+                                    timeout=self._timeout)
+                job.returncode = cp.returncode
+                if cp.returncode == 0:
+                    job.status = 'passed'
+                elif cp.returncode < 0:
+                    job.status = 'crashed'
+                else:
+                    job.status = 'failed'
+            except subprocess.TimeoutExpired:
+                job.status = 'timeout'
+        job.runtime = time.monotonic() - start
+        job.perf = parse_performance(job.log)
+
+        with self._lock:
+            self._history.update(job)
+            print(f"[{job.status.upper():>7}] {job.name} "
+                  f"({job.runtime:.2f}s){self._describe_crash(job)}")
+
+    def _describe_crash(self, job: RegressionJob) -> str:
+        if job.status != 'crashed':
+            return ''
+        try:
+            return f' {signal.Signals(-job.returncode).name}'
+        except ValueError:
+            return f' signal {-job.returncode}'
+
+    def _summarize(self, jobs: list[RegressionJob], wall: float) -> dict:
+        counts = dict()
+        for job in jobs:
+            counts[job.status] = counts.get(job.status, 0) + 1
+
+        return {
+            'summary': {
+                'total': len(jobs),
+                'passed': counts.get('passed', 0),
+                'failed': counts.get('failed', 0),
+                'crashed': counts.get('crashed', 0),
+                'timeout': counts.get('timeout', 0),
+                'workers': self._workers,
+                'wall': round(wall, 3),
+                'cpu': round(sum(job.runtime for job in jobs), 3),
+            },
+            'jobs': [job.to_dict() for job in jobs],
+        }
+
+
+class JUnitRenderer:
+    # Number of trailing log lines attached to a failing testcase.
+    LOG_TAIL_N = 50
+
+    def __init__(self, results: dict):
+        self._results = results
+
+    def render(self, fout: str) -> None:
+        suites = dict()
+        for job in self._results['jobs']:
+            suites.setdefault(job['project'], list()).append(job)
+
+        root = ET.Element('testsuites')
+        for project, jobs in suites.items():
+            suite = ET.SubElement(root, 'testsuite', {
+                'name': project,
+                'tests': str(len(jobs)),
+                'failures': str(
+                    sum(1 for j in jobs if j['status'] == 'failed')),
+                'errors': str(
+                    sum(1 for j in jobs if j['status'] in
+                        ['crashed', 'timeout'])),
+                'time': str(sum(j['runtime'] for j in jobs)),
+            })
+            for job in jobs:
+                self._render_testcase(suite, job)
+
+        ET.indent(root)
+        ET.ElementTree(root).write(fout, encoding='utf-8',
+                                   xml_declaration=True)
+
+    def _render_testcase(self, suite: ET.Element, job: dict) -> None:
+        # Tagged entries of the same test (for example, differing only in
+        # arguments) are otherwise indistinguishable.
+        name = job['test']
+        if job.get('tag'):
+            name += f".{job['tag']}"
+        if job['seed'] is not None:
+            name += f"[seed={job['seed']}]"
+
+        case = ET.SubElement(suite, 'testcase', {
+            'classname': f"{job['project']}.{job['instance']}",
+            'name': name,
+            'time': str(job['runtime']),
+        })
+        if job['status'] == 'passed':
+            return
+
+        tag = 'failure' if job['status'] == 'failed' else 'error'
+        element = ET.SubElement(case, tag, {
+            'message': f"{job['status']} (returncode: {job['returncode']})",
+        })
+        element.text = self._log_tail(job['log'])
+
+    def _log_tail(self, log: typing.Optional[str]) -> str:
+        if not log or not os.path.exists(log):
+            return ''
+        with open(log, 'r', errors='replace') as f:
+            return ''.join(f.readlines()[-self.LOG_TAIL_N:])
@@ -32,17 +32,35 @@ import re
 import tempfile
 
 class PLARenderer:
-    def __init__(self, pla_region: list[str]):
+    # Optimization scripts selectable per region by the '.opt' directive.
+    # Cubes are otherwise emitted unminimized as flat two-level logic.
+    OPT_SCRIPTS = {
+        # Unminimized two-level logic.
+        'none': [],
+        # Espresso-style two-level minimization of each output.
+        'two_level': ['espresso'],
+        # Multi-level restructuring for area.
+        'area': ['strash', 'dc2', 'rewrite -z', 'refactor -z', 'rewrite -z'],
+        # Multi-level restructuring with depth-oriented balancing.
+        'depth': ['strash', 'balance', 'rewrite', 'refactor', 'balance',
+                  'rewrite -z', 'refactor -z', 'rewrite -z', 'balance'],
+    }
+
+    def __init__(self, pla_region: list[str], name: str = 'pla'):
         self._i_token_mappings = list()
         self._o_token_mappings = list()
         self._terms = list()
         self._pla_region = pla_region
+        self._name = name
+        self._opt = 'none'
 
     def render(self) -> list[str]:
         print('Rendering PLA region...')
 
         for line in self._remove_encapsulation(self._pla_region):
-            if line.startswith('.i'):
+            if line.startswith('.opt'):
+                self._process_opt_directive(line)
+            elif line.startswith('.i'):
                 self._process_directive(line, self._i_token_mappings)
             elif line.startswith('.o'):
                 self._process_directive(line, self._o_token_mappings)
@@ -58,6 +76,7 @@ class PLARenderer:
         
         with (tempfile.NamedTemporaryFile(mode='w+', delete=False) as cmdfile,
               tempfile.NamedTemporaryFile(mode='w+', delete=False) as scriptfile,
+              tempfile.NamedTemporaryFile(delete=False) as unoptfile,
               tempfile.NamedTemporaryFile(delete=False) as verilogfile):
 
             # Write espresso/PLA script.
@@ -65,23 +84,43 @@ class PLARenderer:
             cmdfile.flush()
 
             # Write ABC script.
-            self._write_abc_script(scriptfile, cmdfile.name, verilogfile.name)
+            self._write_abc_script(
+                scriptfile, cmdfile.name, unoptfile.name, verilogfile.name)
             scriptfile.flush()
 
             if not self._invoke_abc(scriptfile.name):
                 raise RuntimeError("ABC invocation failed.")
 
+            with open(unoptfile.name, 'r') as unoptimized_verilog:
+                before = self._measure(unoptimized_verilog.read())
+
             # Extract expressions from synthesized Verilog output.
             with open(verilogfile.name, 'r') as synthesized_verilog:
-                return self._render_verilog(synthesized_verilog)
+                text = synthesized_verilog.read()
+
+            after = self._measure(text)
+            print(f"PLA region '{self._name}' ({self._opt}): "
+                  f"literals {before[0]} -> {after[0]}, "
+                  f"depth {before[1]} -> {after[1]}")
+
+            return self._render_verilog(text)
 
-    def _render_verilog(self, synthesized_verilog) -> list[str]:
+    def _render_verilog(self, synthesized_verilog: str) -> list[str]:
         out = list()
 
-        for line in synthesized_verilog.readlines():
+        # Nodes internal to the optimized network are declared locally and
+        # prefixed by the region name to avoid collisions.
+        wires = self._internal_wires(synthesized_verilog)
+        for wire in wires:
+            out.append(f'logic {self._name}_{wire};\n')
+
+        for line in synthesized_verilog.split('\n'):
             if 'assign' not in line:
                 continue
 
+            for wire in wires:
+                line = re.sub(rf'\b{wire}\b', f'{self._name}_{wire}', line)
+
             for orig, repl in self._i_token_mappings:
                 line = line.replace(repl, orig)
 
@@ -90,10 +129,75 @@ class PLARenderer:
 
             line = line.lstrip()
 
-            out.append(line)
+            out.append(f'{line}\n')
 
         return out
 
+    def _internal_wires(self, synthesized_verilog: str) -> list[str]:
+        wires = list()
+        for decl in re.findall(r'\bwire\b([^;]*);', synthesized_verilog):
+            wires.extend(w.strip() for w in decl.split(',') if w.strip())
+        return wires
+
+    def _measure(self, synthesized_verilog: str) -> typing.Tuple[int, int]:
+        # Literal count and depth (in two-input gates, inversions free) of
+        # the network described by the assignments of the Verilog output.
+        exprs = dict()
+        for lhs, rhs in re.findall(r'assign\s+(\w+)\s*=\s*([^;]*);',
+                                   synthesized_verilog):
+            exprs[lhs] = rhs
+
+        depths = dict()
+
+        def depth_of(name: str) -> int:
+            if name not in exprs:
+                return 0
+            if name not in depths:
+                depths[name] = parse(tokenize(exprs[name]))[0]
+            return depths[name]
+
+        def tokenize(rhs: str) -> list[str]:
+            return re.findall(r"1'b[01]|[~&|^()]|\w+", rhs)
+
+        def parse(tokens: list[str]) -> typing.Tuple[int, int]:
+            # Precedence climbing over '|', '^', '&'; returns (depth,
+            # literals) of the expression.
+            pos = 0
+
+            def operand() -> typing.Tuple[int, int]:
+                nonlocal pos
+                tok = tokens[pos]
+                pos += 1
+                if tok == '~':
+                    return operand()
+                if tok == '(':
+                    r = binary(0)
+                    pos += 1
+                    return r
+                if tok.startswith("1'b"):
+                    return (0, 0)
+                return (depth_of(tok), 1)
+
+            def binary(level: int) -> typing.Tuple[int, int]:
+                nonlocal pos
+                ops = ['|', '^', '&']
+                if level == len(ops):
+                    return operand()
+                terms = [binary(level + 1)]
+                while pos < len(tokens) and tokens[pos] == ops[level]:
+                    pos += 1
+                    terms.append(binary(level + 1))
+                d = max(t[0] for t in terms)
+                if len(terms) > 1:
+                    d += (len(terms) - 1).bit_length()
+                return (d, sum(t[1] for t in terms))
+
+            return binary(0)
+
+        literals = sum(parse(tokenize(rhs))[1] for rhs in exprs.values())
+        depth = max((depth_of(lhs) for lhs in exprs), default=0)
+        return (literals, depth)
+
     def _process_cube(self, line: str) -> None:
         i_n = len(self._i_token_mappings)
         o_n = len(self._o_token_mappings)
@@ -121,6 +225,12 @@ class PLARenderer:
         
         return re.sub(r'\\\n', '', ''.join(comments_removed)).split('\n')
     
+    def _process_opt_directive(self, line: str) -> None:
+        tokens = line.split()
+        if len(tokens) != 2 or tokens[1] not in self.OPT_SCRIPTS:
+            raise ValueError(f"Invalid PLA optimization directive: {line}")
+        self._opt = tokens[1]
+
     def _process_directive(self, line: str, mappings) -> None:
         tokens = line.split()
         for token in tokens[1:]:
@@ -148,8 +258,12 @@ class PLARenderer:
 
         of.write(".e\n")
 
-    def _write_abc_script(self, scriptfile, cmdfilename, verilogfilename) -> None:
+    def _write_abc_script(self, scriptfile, cmdfilename, unoptfilename,
+                          verilogfilename) -> None:
         scriptfile.write(f"read_pla {cmdfilename}\n")
+        scriptfile.write(f"write_verilog {unoptfilename}\n")
+        for cmd in self.OPT_SCRIPTS[self._opt]:
+            scriptfile.write(f"{cmd}\n")
         scriptfile.write(f"write_verilog {verilogfilename}\n")
 
     def _invoke_abc(self, scriptfilename) -> None:
@@ -255,6 +369,195 @@ class Verilator:
             tf.write("COMPILED")
 
 
+class PPAReporter:
+    # Generic cell library against which controllers are mapped. Areas are
+    # in units of a NAND2 equivalent and delays in units of a unit-load
+    # inverter, such that results are comparable between implementations
+    # rather than representative of any given process.
+    GENLIB = [
+        'GATE ZERO  0 Y=CONST0;',
+        'GATE ONE   0 Y=CONST1;',
+        'GATE BUF   1 Y=A;            PIN * NONINV  1 999 1.0 0 1.0 0',
+        'GATE INV   1 Y=!A;           PIN * INV     1 999 1.0 0 1.0 0',
+        'GATE NAND2 1 Y=!(A*B);       PIN * INV     1 999 1.0 0 1.0 0',
+        'GATE NOR2  1 Y=!(A+B);       PIN * INV     1 999 1.4 0 1.4 0',
+        'GATE AND2  2 Y=A*B;          PIN * NONINV  1 999 2.0 0 2.0 0',
+        'GATE OR2   2 Y=A+B;          PIN * NONINV  1 999 2.4 0 2.4 0',
+        'GATE AOI21 2 Y=!(A*B+C);     PIN * INV     1 999 1.6 0 1.6 0',
+        'GATE OAI21 2 Y=!((A+B)*C);   PIN * INV     1 999 1.6 0 1.6 0',
+        'GATE XOR2  3 Y=A*!B+!A*B;    PIN * UNKNOWN 2 999 2.5 0 2.5 0',
+        'GATE XNOR2 3 Y=A*B+!A*!B;    PIN * UNKNOWN 2 999 2.5 0 2.5 0',
+    ]
+
+    def __init__(self, project: dict, filelist: str, module: str):
+        self._project = project
+        self._filelist = filelist
+        self._module = module
+
+    def report(self) -> dict:
+        print(f'Reporting PPA for module: {self._module}')
+
+        with tempfile.TemporaryDirectory() as work_dir:
+            blif = os.path.join(work_dir, f'{self._module}.blif')
+            ys = os.path.join(work_dir, 'ppa.ys')
+            with open(ys, 'w') as f:
+                self._write_yosys_script(f, blif)
+            self._invoke_yosys(ys)
+
+            genlib = os.path.join(work_dir, 'generic.genlib')
+            with open(genlib, 'w') as f:
+                f.write('\n'.join(self.GENLIB))
+                f.write('\n')
+
+            script = os.path.join(work_dir, 'ppa.abc')
+            with open(script, 'w') as f:
+                self._write_abc_script(f, blif, genlib)
+
+            return self._parse_stats(self._invoke_abc(script))
+
+    def _write_yosys_script(self, of, blifname) -> None:
+        # Elaborate the rendered sources (PLA regions expanded) and lower the
+        # module to a flat netlist of simple gates. No logic optimization is
+        # applied beyond constant propagation and removal of dead logic, such
+        # that the structure of the implementation is retained through to
+        # mapping. Flops (if any) are retained as latches in the netlist.
+        defines = ' '.join(
+            f'-D{k}={v}'
+            for k, v in self._project.get('defines', dict()).items())
+
+        includes = [os.path.dirname(self._filelist)]
+        includes.extend(self._project.get('directories', list()))
+        includes = ' '.join(f'-I{include}' for include in includes)
+
+        with open(self._filelist, 'r') as flist:
+            for file in flist:
+                file_nl = file.rstrip('\n')
+                if file_nl:
+                    of.write(f'read_verilog -sv -defer {defines} {includes} '
+                             f'{file_nl}\n')
+
+        of.write(f'hierarchy -check -top {self._module}\n')
+        of.write('proc\n')
+        of.write('flatten\n')
+        of.write('opt_clean\n')
+        of.write('async2sync\n')
+        of.write('dffunmap\n')
+        of.write('techmap\n')
+        of.write('opt_expr\n')
+        of.write('opt_clean -purge\n')
+        of.write(f'write_blif {blifname}\n')
+
+    def _invoke_yosys(self, scriptfilename) -> None:
+        import subprocess
+
+        from cfg import YOSYS_EXE
+
+        print("Invoking Yosys...")
+        cp = subprocess.run([YOSYS_EXE, "-q", "-s", scriptfilename])
+        if cp.returncode != 0:
+            raise RuntimeError("Yosys invocation failed.")
+
+    def _write_abc_script(self, scriptfile, blifname, libfilename) -> None:
+        # Map the netlist as elaborated; multi-level restructuring (for
+        # example, 'dc2') is deliberately omitted, as it would otherwise
+        # erase the differences between implementations being compared.
+        scriptfile.write(f"read_library {libfilename}\n")
+        scriptfile.write(f"read_blif {blifname}\n")
+        scriptfile.write("strash\n")
+        scriptfile.write("print_stats\n")
+        scriptfile.write("map\n")
+        scriptfile.write("print_stats\n")
+
+    def _invoke_abc(self, scriptfilename) -> str:
+        import subprocess
+
+        from cfg import ABC_EXE
+
+        print("Invoking ABC...")
+        cp = subprocess.run([ABC_EXE, "-f", scriptfilename],
+                            capture_output=True, text=True)
+        if cp.returncode != 0:
+            raise RuntimeError("ABC invocation failed.")
+        return cp.stdout
+
+    def _parse_stats(self, stdout: str) -> dict:
+        # Each 'print_stats' emits a single summary line; the first follows
+        # structural hashing (AIG), the second technology mapping. Port
+        # widths are taken from the netlist ('i/o = <in>/<out>'), rather
+        # than from the RTL declaration, such that any declaration style
+        # (packed types, typedefs, multi-dimensional ports) is accounted for.
+        stats = [line for line in stdout.split('\n') if 'i/o' in line]
+        if len(stats) != 2:
+            raise RuntimeError("Unable to parse ABC statistics.")
+
+        def field(line, name, kind=int):
+            m = re.search(rf'\b{name}\s*=\s*([\d.]+)', line)
+            if not m:
+                raise RuntimeError(f"ABC statistic missing: {name}")
+            return kind(m.group(1))
+
+        aig, mapped = stats
+        io = re.search(r'i/o\s*=\s*(\d+)\s*/\s*(\d+)', aig)
+        if not io:
+            raise RuntimeError("ABC statistic missing: i/o")
+
+        return {
+            'inputs': int(io.group(1)),
+            'outputs': int(io.group(2)),
+            'flops': field(aig, 'lat'),
+            'aig_nodes': field(aig, 'and'),
+            'aig_depth': field(aig, 'lev'),
+            'gates': field(mapped, 'nd'),
+            'area': field(mapped, 'area', float),
+            'depth': field(mapped, 'lev'),
+            'critical_path': field(mapped, 'delay', float),
+        }
+
+
+class CfgHeaderRenderer:
+    PREFIX = 'TB_CFG__'
+
+    def __init__(self, name: str, defines: dict):
+        self._name = name
+        self._defines = defines
+
+    def render(self) -> str:
+        guard = f'CFG_{self._name.upper()}_H'
+        out = [
+            f'// Generated from the configuration of {self._name}; do not edit.',
+            '',
+            f'#ifndef {guard}',
+            f'#define {guard}',
+            '',
+            '#include <cstdint>',
+            '#include <string_view>',
+            '',
+            'namespace cfg {',
+            '',
+            f'struct {self._name} {{',
+        ]
+        for k, v in self._defines.items():
+            if not k.startswith(self.PREFIX):
+                continue
+            out.append(f'  {self._render_constant(k[len(self.PREFIX):], v)}')
+        out.extend([
+            '};',
+            '',
+            '}  // namespace cfg',
+            '',
+            f'#endif  // {guard}',
+            '',
+        ])
+        return '\n'.join(out)
+
+    def _render_constant(self, name: str, value) -> str:
+        if isinstance(value, bool):
+            return f'static constexpr bool {name} = {str(value).lower()};'
+        if isinstance(value, int):
+            return f'static constexpr std::int64_t {name} = {value};'
+        return f'static constexpr std::string_view {name} = "{value}";'
+
+
 class RTLRenderer:
     def __init__(self, project_file: str, rtl_dir: str, vout_dir: str):
         self._project = self._load_project(project_file)
@@ -313,6 +616,13 @@ class RTLRenderer:
                 project['flags'] = list()
             project['flags'].extend(inc_project['flags'])
 
+        # Defines of the including project take precedence.
+        if 'defines' in inc_project:
+            if 'defines' not in project:
+                project['defines'] = dict()
+            for k, v in inc_project['defines'].items():
+                project['defines'].setdefault(k, v)
+
     def render_rtl(self) -> typing.Tuple[bool, list[str]]:
         files = list()
 
@@ -343,6 +653,59 @@ class RTLRenderer:
         v = Verilator(project=self._project, filelist=filelist, vout_dir=self._vout_dir)
         v.execute(force=modified)    
 
+    def render_cfg(self, cfg_dir: str) -> str:
+        # Render the build-time configuration of the instance (its TB_CFG__
+        # defines, from which the RTL packages are elaborated) as a C++
+        # header, such that the testbench may be specialized at compile time.
+        top_module = os.path.basename(
+            os.path.splitext(self._project['top'])[0])
+
+        if not os.path.exists(cfg_dir):
+            os.makedirs(cfg_dir)
+
+        fout = os.path.join(cfg_dir, f'{top_module}.h')
+        content = CfgHeaderRenderer(
+            top_module, self._project.get('defines', dict())).render()
+
+        # Retain timestamp when unchanged to avoid spurious recompilation.
+        if os.path.exists(fout):
+            with open(fout, 'r') as f:
+                if f.read() == content:
+                    return fout
+
+        print(f"Rendering configuration header to {fout}")
+        with open(fout, 'w') as f:
+            f.write(content)
+        return fout
+
+    def report_ppa(self, fout: str) -> dict:
+        # Synthesize the combinational logic of each module named in the
+        # project 'report' section and write the resultant PPA figures as
+        # JSON, such that implementations may be compared and regressed.
+        import json
+
+        _, filelist = self.render_rtl()
+
+        top_module = os.path.basename(
+            os.path.splitext(self._project['top'])[0])
+
+        report = {
+            'instance': top_module,
+            'library': 'generic',
+            'modules': dict(),
+        }
+        for module in self._project.get('report', list()):
+            report['modules'][module] = PPAReporter(
+                project=self._project, filelist=filelist,
+                module=module).report()
+
+        print(f"Rendering PPA report to {fout}")
+        with open(fout, 'w') as f:
+            json.dump(report, f, indent=2)
+            f.write('\n')
+
+        return report
+
     def _render_file(self, fin: str, fout: str) -> None:
         print(f"Rendering RTL: {fin} to {fout}")
         with (open(fout, 'w') as o, open(fin, 'r') as i):
@@ -350,11 +713,15 @@ class RTLRenderer:
             out_render = list()
             in_pla_region = False
             pla_region = list()
+            pla_region_n = 0
             for line in i.readlines():
                 if re.search(r'PLA_END', line):
                     print("End PLA region.")
                     in_pla_region = False
-                    out_render.extend(PLARenderer(pla_region).render())              
+                    out_render.extend(PLARenderer(
+                        pla_region, name=f'pla{pla_region_n}').render())
+                    pla_region = list()
+                    pla_region_n += 1
                 elif in_pla_region:
                     pla_region.append(line)
                 elif re.search(r'PLA_BEGIN', line):
@@ -0,0 +1,101 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_ALLOC_H
+#define TB_TB_ALLOC_H
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace tb::alloc {
+
+// Phases of a run, over which heap allocations (operator new) are accounted.
+enum class Phase : std::size_t {
+  Elaborate,
+  Reset,
+  Run,
+  Finalize,
+};
+
+inline constexpr std::size_t PHASES_N = 4;
+
+struct Counts {
+  std::size_t allocs_n{0};
+  std::size_t bytes_n{0};
+};
+
+// Enable accounting of allocations, from the simulation thread. Phases
+// account the allocations of all threads; cycles, those of the simulation
+// thread alone. In strict mode, an allocation by the test (on_negedge)
+// aborts the run once warmup_cycles_n cycles of the Run phase have elapsed.
+void enable(bool strict = false, std::size_t warmup_cycles_n = 0) noexcept;
+
+bool enabled() noexcept;
+
+void set_phase(Phase p) noexcept;
+
+Counts phase_counts(Phase p) noexcept;
+
+// Allocations across all phases.
+Counts total_counts() noexcept;
+
+// Mark the end of a cycle of the Run phase (on the simulation thread);
+// allocations per cycle are measured between consecutive calls.
+void end_cycle() noexcept;
+
+// Scope of the per-cycle test hook (on_negedge) on the calling thread.
+class HotPathScope {
+ public:
+  explicit HotPathScope() noexcept;
+  ~HotPathScope();
+
+  HotPathScope(const HotPathScope&) = delete;
+  HotPathScope& operator=(const HotPathScope&) = delete;
+};
+
+// Scope, within the per-cycle test hook, of work amortized over many cycles
+// (for example, at frame boundaries); its allocations are accounted, but are
+// not fatal in strict mode.
+class ColdPathScope {
+ public:
+  explicit ColdPathScope() noexcept;
+  ~ColdPathScope();
+
+  ColdPathScope(const ColdPathScope&) = delete;
+  ColdPathScope& operator=(const ColdPathScope&) = delete;
+
+ private:
+  bool was_in_hot_path_;
+};
+
+// Report allocations per phase and per cycle, alongside the heap footprint
+// of the Verilated model and the peak resident set size.
+void report(std::ostream& os, std::size_t model_bytes_n);
+
+}  // namespace tb::alloc
+
+#endif  // TB_TB_ALLOC_H
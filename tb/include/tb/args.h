@@ -0,0 +1,87 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_ARGS_H
+#define TB_TB_ARGS_H
+
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace tb {
+
+// Test argument parser. Arguments are passed to tests as a single string
+// of comma-separated key=value pairs, for example:
+//
+//   --args "seed=1,max_cycles=100000,cov_save=run0.cov"
+//
+// A key without a value is interpreted as a boolean flag set to "1".
+class TestArgs {
+ public:
+  explicit TestArgs(const std::string& args);
+
+  // Test for presence of key.
+  bool has(const std::string& key) const noexcept {
+    return args_.find(key) != args_.end();
+  }
+
+  // Raw value of key, if present.
+  std::optional<std::string> get(const std::string& key) const;
+
+  // Value of key converted to T, otherwise the default value.
+  template <typename T>
+  T get_or(const std::string& key, const T& dflt) const;
+
+ private:
+  std::unordered_map<std::string, std::string> args_;
+};
+
+template <typename T>
+T TestArgs::get_or(const std::string& key, const T& dflt) const {
+  const std::optional<std::string> v{get(key)};
+  if (!v) {
+    return dflt;
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    return *v;
+  } else {
+    T t{};
+    std::istringstream is{*v};
+    if (!(is >> t)) {
+      throw std::runtime_error("Malformed test argument: " + key + "=" + *v);
+    }
+    return t;
+  }
+}
+
+}  // namespace tb
+
+#endif  // TB_TB_ARGS_H
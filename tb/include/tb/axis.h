@@ -0,0 +1,247 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_AXIS_H
+#define TB_TB_AXIS_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+
+#include "tb/ring_buffer.h"
+
+namespace tb::axis {
+
+// Binding to the handshake ports of an AXI-Stream interface on a Verilated
+// instance. Single-bit ports are represented as vluint8_t by Verilator.
+// TLAST/TUSER are optional and may be left unbound.
+struct Ports {
+  const std::uint8_t* valid{nullptr};
+  const std::uint8_t* ready{nullptr};
+  const std::uint8_t* last{nullptr};
+  const std::uint8_t* user{nullptr};
+};
+
+// Handshake state of an interface for a single cycle.
+struct Handshake {
+  bool valid;
+  bool ready;
+  bool last;
+  bool user;
+
+  bool fire() const noexcept { return valid && ready; }
+};
+
+// Histogram with power-of-two bucket boundaries; bucket k accumulates
+// samples in range [2^(k-1), 2^k). Fixed storage, never allocates.
+class Log2Histogram {
+ public:
+  static constexpr std::size_t BUCKETS_N = 64;
+
+  void sample(std::uint64_t v) noexcept;
+
+  std::uint64_t count() const noexcept { return n_; }
+  std::uint64_t min() const noexcept { return n_ ? min_ : 0; }
+  std::uint64_t max() const noexcept { return max_; }
+  double mean() const noexcept { return n_ ? double(sum_) / n_ : 0.0; }
+
+  void report(std::ostream& os, const std::string& units) const;
+
+ private:
+  std::array<std::uint64_t, BUCKETS_N> buckets_{};
+  std::uint64_t n_{0};
+  std::uint64_t sum_{0};
+  std::uint64_t min_{std::numeric_limits<std::uint64_t>::max()};
+  std::uint64_t max_{0};
+};
+
+// Passive monitor of a single AXI-Stream interface. Accumulates handshake
+// statistics and throughput over fixed windows of cycles. Each beat carries
+// 'pixels_per_beat' pixels (elements); throughput is expressed in pixels.
+class Monitor {
+ public:
+  explicit Monitor(const std::string& name, const Ports& ports,
+    std::size_t window_n = 256, std::size_t pixels_per_beat = 1);
+
+  // Sample interface; invoked once per cycle once all inputs to the
+  // interface have settled (i.e. the values presented at the next edge).
+  const Handshake& sample() noexcept;
+
+  const std::string& name() const noexcept { return name_; }
+  const Handshake& current() const noexcept { return hs_; }
+
+  std::uint64_t cycles_n() const noexcept { return cycles_n_; }
+  std::uint64_t beats_n() const noexcept { return beats_n_; }
+  std::uint64_t pixels_n() const noexcept { return beats_n_ * ppb_; }
+  std::size_t pixels_per_beat() const noexcept { return ppb_; }
+  std::uint64_t ready_n() const noexcept { return ready_n_; }
+
+  // VALID asserted while READY is deasserted.
+  std::uint64_t stall_n() const noexcept { return stall_n_; }
+
+  // READY asserted while VALID is deasserted.
+  std::uint64_t bubble_n() const noexcept { return bubble_n_; }
+
+  std::uint64_t sof_n() const noexcept { return sof_n_; }
+  std::uint64_t eol_n() const noexcept { return eol_n_; }
+
+  // Fraction of cycles in which READY is asserted.
+  double ready_duty() const noexcept { return ratio(ready_n_, cycles_n_); }
+
+  // Pixels per cycle over the lifetime of the monitor.
+  double throughput() const noexcept { return ratio(pixels_n(), cycles_n_); }
+
+  // Pixels per cycle, as observed over complete windows.
+  double window_min() const noexcept { return windows_n_ ? window_min_ : 0; }
+  double window_max() const noexcept { return window_max_; }
+
+  void report(std::ostream& os) const;
+
+ private:
+  static double ratio(std::uint64_t n, std::uint64_t d) noexcept {
+    return d ? double(n) / d : 0.0;
+  }
+
+  static bool read(const std::uint8_t* p) noexcept { return p && (*p != 0); }
+
+  std::string name_;
+  Ports ports_;
+  std::size_t ppb_;
+  Handshake hs_{};
+
+  std::uint64_t cycles_n_{0};
+  std::uint64_t beats_n_{0};
+  std::uint64_t ready_n_{0};
+  std::uint64_t stall_n_{0};
+  std::uint64_t bubble_n_{0};
+  std::uint64_t sof_n_{0};
+  std::uint64_t eol_n_{0};
+
+  // Throughput windows
+  std::size_t window_n_;
+  std::size_t window_cycles_n_{0};
+  std::size_t window_beats_n_{0};
+  std::uint64_t windows_n_{0};
+  double window_min_{std::numeric_limits<double>::max()};
+  double window_max_{0.0};
+};
+
+// Monitor of a stream path through some DUT, from an ingress (slave)
+// interface to an egress (master) interface. Ingress and egress beats are
+// assumed to correspond one-to-one and in-order; beat latency is the
+// number of cycles between acceptance at ingress and at egress.
+//
+// Each egress cycle in which a beat is not transferred is attributed to:
+//
+//  - Downstream: egress READY is deasserted.
+//
+//  - Upstream:   egress READY is asserted, but no data was available at
+//                ingress (ingress VALID deasserted) one path latency
+//                earlier, where the path latency is the minimum observed
+//                to date (zero prior to the first egress beat).
+//
+//  - DUT:        otherwise; egress READY is asserted and data was
+//                available at ingress, but the DUT presents no egress beat.
+//
+// Attribution is by the ingress state of a single (latency-delayed) cycle;
+// where an egress beat depends upon several ingress beats (e.g. the lines
+// buffered ahead by a convolution), an upstream bubble may be attributed to
+// the DUT, and vice-versa. Latencies beyond HISTORY_N cycles are clamped.
+//
+// Ingress and egress beats each carry 'pixels_per_beat' pixels; throughput
+// is expressed in pixels per cycle.
+class PathMonitor {
+ public:
+  // Cycles of ingress history retained for stall attribution.
+  static constexpr std::size_t HISTORY_N = 64;
+
+  explicit PathMonitor(const std::string& name, const Ports& ingress,
+    const Ports& egress, std::size_t pixels_per_beat = 1,
+    std::size_t window_n = 256, std::size_t inflight_n = 1 << 16);
+
+  // Sample ingress and egress interfaces; invoked once per cycle.
+  void sample() noexcept;
+
+  // Throughput assertion: the egress interface must sustain at least
+  // 'rate' pixels per cycle over each window of cycles in which neither
+  // downstream nor upstream stall the path (i.e. rate 1.0 at one pixel per
+  // beat: "must sustain one beat per cycle whenever READY is asserted").
+  // Windows preceding the first egress beat (pipeline fill) are excluded.
+  void expect_throughput(double rate) noexcept { min_rate_ = rate; }
+
+  // Check assertions; throws std::runtime_error on violation.
+  void check() const;
+
+  const Monitor& ingress() const noexcept { return ingress_; }
+  const Monitor& egress() const noexcept { return egress_; }
+  const Log2Histogram& latency() const noexcept { return latency_; }
+
+  std::uint64_t upstream_stall_n() const noexcept { return upstream_n_; }
+  std::uint64_t downstream_stall_n() const noexcept { return downstream_n_; }
+  std::uint64_t dut_stall_n() const noexcept { return dut_n_; }
+
+  void report(std::ostream& os) const;
+
+ private:
+  void sample_throughput(bool eligible, bool fire) noexcept;
+
+  std::string name_;
+  Monitor ingress_;
+  Monitor egress_;
+
+  // Ingress acceptance cycle of in-flight beats.
+  RingBuffer<std::uint64_t> inflight_;
+  std::uint64_t inflight_overflow_n_{0};
+  std::uint64_t unmatched_n_{0};
+  Log2Histogram latency_;
+
+  // Ingress VALID of prior cycles; bit i corresponds to i cycles ago.
+  std::uint64_t ingress_valid_hist_{0};
+
+  // Stall attribution
+  std::uint64_t upstream_n_{0};
+  std::uint64_t downstream_n_{0};
+  std::uint64_t dut_n_{0};
+
+  // Throughput assertion
+  std::size_t ppb_;
+  std::size_t window_n_;
+  double min_rate_{0.0};
+  bool warm_{false};
+  std::size_t window_cycles_n_{0};
+  std::size_t window_beats_n_{0};
+  std::uint64_t violations_n_{0};
+  std::uint64_t first_violation_cycle_{0};
+  std::uint64_t rate_windows_n_{0};
+  double worst_rate_{std::numeric_limits<double>::max()};
+};
+
+}  // namespace tb::axis
+
+#endif  // TB_TB_AXIS_H
@@ -0,0 +1,244 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_AXIS_VIP_H
+#define TB_TB_AXIS_VIP_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "tb/ring_buffer.h"
+
+namespace tb::axis {
+
+// Binding of an AXI-Stream interface to the ports of a Verilated model. A
+// binding is a type of static accessors, such that all port accesses are
+// resolved at compile time:
+//
+//   struct Binding {
+//     using model_type = Vtop;
+//     using beat_type = Beat;
+//
+//     static bool valid(const Vtop& m) noexcept;
+//     static bool ready(const Vtop& m) noexcept;
+//
+//     // Decode payload presented on the interface.
+//     static Beat beat(const Vtop& m) noexcept;
+//
+//     // (Source bindings only) Present beat on the interface; or idle.
+//     static void drive(Vtop& m, const Beat& b) noexcept;
+//     static void idle(Vtop& m) noexcept;
+//   };
+//
+template <typename B>
+concept Binding = requires(const typename B::model_type& m) {
+  typename B::beat_type;
+  { B::valid(m) } -> std::convertible_to<bool>;
+  { B::ready(m) } -> std::convertible_to<bool>;
+  { B::beat(m) } -> std::convertible_to<typename B::beat_type>;
+};
+
+template <typename B>
+concept SourceBinding = Binding<B> &&
+  requires(typename B::model_type& m, const typename B::beat_type& b) {
+    B::drive(m, b);
+    B::idle(m);
+  };
+
+// Beat driver of a (slave) interface of the model. Beats are queued ahead
+// of time into fixed storage and presented in order; once presented, a beat
+// is held until accepted, irrespective of the requested activity.
+template <SourceBinding B>
+class BeatDriver {
+ public:
+  using model_type = typename B::model_type;
+  using beat_type = typename B::beat_type;
+
+  explicit BeatDriver(std::size_t capacity = 16) : q_(capacity) {}
+
+  // Queue beat; returns false (and discards b) if full.
+  bool push(const beat_type& b) noexcept { return q_.push_back(b); }
+
+  bool full() const noexcept { return q_.full(); }
+  bool empty() const noexcept { return q_.empty(); }
+  std::size_t size() const noexcept { return q_.size(); }
+
+  // Drive the interface for the upcoming edge. A new beat is presented
+  // only when 'active'. READY must have settled (and be independent of
+  // VALID). Returns the presented beat, if any, which is retired if
+  // accepted at the edge.
+  const beat_type* drive(model_type& m, bool active) noexcept {
+    presented_ = presented_ || (active && !q_.empty());
+    if (!presented_) {
+      B::idle(m);
+      return nullptr;
+    }
+
+    const beat_type* b = &q_.front();
+    B::drive(m, *b);
+    if (B::ready(m)) {
+      // Storage of the retired beat is retained until the next push.
+      q_.pop_front();
+      presented_ = false;
+      ++beats_n_;
+    }
+    return b;
+  }
+
+  std::uint64_t beats_n() const noexcept { return beats_n_; }
+
+ private:
+  RingBuffer<beat_type> q_;
+  bool presented_{false};
+  std::uint64_t beats_n_{0};
+};
+
+// Passive beat monitor of an interface of the model. The payload is decoded
+// only for beats transferred.
+template <Binding B>
+class BeatMonitor {
+ public:
+  using model_type = typename B::model_type;
+  using beat_type = typename B::beat_type;
+
+  // Sample interface; invoked once per cycle once all inputs to the
+  // interface have settled. Returns the beat transferred at the upcoming
+  // edge, if any; valid until the next sample.
+  const beat_type* sample(const model_type& m) noexcept {
+    ++cycles_n_;
+    valid_ = B::valid(m);
+    ready_ = B::ready(m);
+    if (!valid_ || !ready_) {
+      return nullptr;
+    }
+    ++beats_n_;
+    beat_ = B::beat(m);
+    return &beat_;
+  }
+
+  bool valid() const noexcept { return valid_; }
+  bool ready() const noexcept { return ready_; }
+
+  std::uint64_t cycles_n() const noexcept { return cycles_n_; }
+  std::uint64_t beats_n() const noexcept { return beats_n_; }
+
+ private:
+  beat_type beat_{};
+  bool valid_{false};
+  bool ready_{false};
+  std::uint64_t cycles_n_{0};
+  std::uint64_t beats_n_{0};
+};
+
+// Scoreboard of expected transactions, in fixed storage. Actual
+// transactions are matched in-order, against the oldest outstanding
+// expectation.
+template <typename T>
+class Scoreboard {
+ public:
+  using value_type = T;
+
+  enum class Result {
+    Match,
+    Mismatch,
+    Unexpected,
+  };
+
+  explicit Scoreboard(std::size_t capacity) : q_(capacity) {}
+
+  // Expect transaction t. Named for compatibility with std::back_inserter.
+  void push_back(const T& t) {
+    if (!q_.push_back(t)) {
+      throw std::runtime_error("Scoreboard capacity exceeded");
+    }
+  }
+
+  bool empty() const noexcept { return q_.empty(); }
+  std::size_t size() const noexcept { return q_.size(); }
+
+  // Oldest outstanding expectation.
+  const T& front() const noexcept { return q_.front(); }
+
+  // Observe actual transaction a; match(e, a) is true when a satisfies the
+  // expectation e. On mismatch, on_mismatch(e, a) is invoked before the
+  // expectation is retired.
+  template <typename U, typename Match, typename OnMismatch>
+  Result observe(const U& a, Match&& match, OnMismatch&& on_mismatch);
+
+  template <typename U, typename Match>
+  Result observe(const U& a, Match&& match) {
+    return observe(a, std::forward<Match>(match), [](const T&, const U&) {});
+  }
+
+  Result observe(const T& a) { return observe(a, std::equal_to<T>{}); }
+
+  std::uint64_t matched_n() const noexcept { return matched_n_; }
+  std::uint64_t mismatched_n() const noexcept { return mismatched_n_; }
+  std::uint64_t unexpected_n() const noexcept { return unexpected_n_; }
+
+  void report(std::ostream& os, const std::string& name) const {
+    os << "Scoreboard '" << name << "': matched=" << matched_n_
+       << " mismatched=" << mismatched_n_ << " unexpected=" << unexpected_n_
+       << " outstanding=" << q_.size() << "\n";
+  }
+
+ private:
+  RingBuffer<T> q_;
+
+  std::uint64_t matched_n_{0};
+  std::uint64_t mismatched_n_{0};
+  std::uint64_t unexpected_n_{0};
+};
+
+template <typename T>
+template <typename U, typename Match, typename OnMismatch>
+auto Scoreboard<T>::observe(const U& a, Match&& match,
+  OnMismatch&& on_mismatch) -> Result {
+  if (q_.empty()) {
+    ++unexpected_n_;
+    return Result::Unexpected;
+  }
+
+  const T& e = q_.front();
+  const bool is_match = match(e, a);
+  if (!is_match) {
+    on_mismatch(e, a);
+  }
+  q_.pop_front();
+  ++(is_match ? matched_n_ : mismatched_n_);
+  return is_match ? Result::Match : Result::Mismatch;
+}
+
+}  // namespace tb::axis
+
+#endif  // TB_TB_AXIS_VIP_H
@@ -0,0 +1,134 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_CLOCK_H
+#define TB_TB_CLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace tb {
+
+// Edge-driven scheduler of one or more free-running clocks of arbitrary
+// period and phase (50% duty cycle). Simulation time advances directly from
+// one edge to the next; the pending edge of each clock is held in a timing
+// wheel whose slots are the greatest common quantum of all half-periods and
+// phases, such that the next edge is found by a scan of the wheel occupancy
+// rather than by visiting every tick.
+//
+//   ClockScheduler cs;
+//   const std::size_t clk = cs.add_clock("clk", 10, 5, set_clk);
+//   cs.on_edge(clk, ClockScheduler::Edge::Falling, on_negedge);
+//   for (;;) {
+//     cs.advance();  // Drive clocks with an edge at the next edge time.
+//     eval();
+//     cs.dispatch();  // Invoke callbacks of those edges.
+//   }
+//
+class ClockScheduler {
+ public:
+  using time_type = std::uint64_t;
+
+  enum class Edge : std::uint8_t { Rising, Falling };
+
+  explicit ClockScheduler() = default;
+
+  // Add clock with the given period (which must be even) and the time of its
+  // first rising edge (phase), in units of simulation time; clocks are
+  // initially low. drive(v) is invoked upon each edge. Clocks must be added
+  // before the first edge. Returns the index of the clock.
+  std::size_t add_clock(const std::string& name, time_type period,
+    time_type phase, std::function<void(bool)> drive);
+
+  // Invoke cb upon each edge of clock clk.
+  void on_edge(std::size_t clk, Edge edge, std::function<void()> cb);
+
+  const std::string& name(std::size_t clk) const { return clocks_[clk].name; }
+
+  // Time of the current edge.
+  time_type now() const noexcept { return now_; }
+
+  // Time of the next edge of any clock.
+  time_type next_time() const noexcept;
+
+  // Advance to the next edge time and drive all clocks with an edge
+  // coincident at that time; returns the number of such edges.
+  std::size_t advance();
+
+  // Invoke the callbacks of the edges at the current time, in order of clock
+  // index; returns true if any were invoked.
+  bool dispatch();
+
+ private:
+  static constexpr std::size_t NIL = static_cast<std::size_t>(-1);
+
+  struct Clock {
+    std::string name;
+    time_type half_period;
+    time_type next;
+    bool level{false};
+
+    std::vector<std::function<void()>> on_rise;
+    std::vector<std::function<void()>> on_fall;
+    std::function<void(bool)> drive;
+
+    // Next clock pending in the same wheel slot.
+    std::size_t link{NIL};
+  };
+
+  // Construct wheel from the clock set.
+  void build();
+
+  std::size_t slot(time_type t) const noexcept {
+    return static_cast<std::size_t>(t / quantum_) & (heads_.size() - 1);
+  }
+
+  void insert(std::size_t clk);
+
+  // Next occupied slot, from slot i (inclusive).
+  std::size_t scan(std::size_t i) const noexcept;
+
+  std::vector<Clock> clocks_;
+
+  bool started_{false};
+  time_type now_{0};
+  time_type quantum_{1};
+
+  // Per slot, the head of the list of pending clocks; and occupancy.
+  std::vector<std::size_t> heads_;
+  std::vector<std::uint64_t> occupied_;
+
+  // Clocks with an edge at the current time.
+  std::vector<std::size_t> fired_;
+};
+
+}  // namespace tb
+
+#endif  // TB_TB_CLOCK_H
@@ -0,0 +1,168 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_COVERAGE_H
+#define TB_TB_COVERAGE_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace tb::coverage {
+
+// Functional cover point comprising a fixed number of bins. A bin is
+// considered closed once it has been hit 'goal' times. Closure is tracked in
+// a bitmap alongside a running count of closed bins such that goal
+// completion can be tested without visiting each bin.
+//
+// All storage is allocated on construction; sampling never allocates.
+class CoverPoint {
+ public:
+  using count_type = std::uint32_t;
+
+  explicit CoverPoint(
+    const std::string& name, std::size_t bins_n, count_type goal = 1);
+  virtual ~CoverPoint() = default;
+
+  const std::string& name() const noexcept { return name_; }
+  std::size_t bins_n() const noexcept { return hits_.size(); }
+  count_type goal() const noexcept { return goal_; }
+
+  // Number of hits recorded against bin.
+  count_type hits(std::size_t bin) const noexcept { return hits_[bin]; }
+
+  // Bin has reached its goal.
+  bool is_closed(std::size_t bin) const noexcept {
+    return (closed_[bin / 64] >> (bin % 64)) & 1;
+  }
+
+  // All bins have reached their goal.
+  bool goals_met() const noexcept { return closed_n_ == bins_n(); }
+
+  std::size_t closed_n() const noexcept { return closed_n_; }
+
+  // Record a hit against bin.
+  void sample(std::size_t bin) noexcept {
+    count_type& h{hits_[bin]};
+    if (h == std::numeric_limits<count_type>::max()) {
+      // Saturate.
+      return;
+    }
+    if (++h == goal_) {
+      close(bin);
+    }
+  }
+
+  // Accumulate n hits against bin (saturating).
+  void add_hits(std::size_t bin, count_type n) noexcept;
+
+  // Accumulate hits from a cover point of identical shape and goal.
+  void merge(const CoverPoint& rhs);
+
+  virtual void report(std::ostream& os) const;
+
+ private:
+  void close(std::size_t bin) noexcept {
+    closed_[bin / 64] |= (std::uint64_t{1} << (bin % 64));
+    ++closed_n_;
+  }
+
+  // Cover point name.
+  std::string name_;
+
+  // Hits required to close each bin.
+  count_type goal_;
+
+  // Per-bin hit counts.
+  std::vector<count_type> hits_;
+
+  // Bitmap of closed bins.
+  std::vector<std::uint64_t> closed_;
+  std::size_t closed_n_{0};
+};
+
+// Cross of two cover points of a_n and b_n bins respectively.
+class CrossPoint : public CoverPoint {
+ public:
+  explicit CrossPoint(const std::string& name, std::size_t a_n,
+    std::size_t b_n, count_type goal = 1)
+      : CoverPoint(name, a_n * b_n, goal), a_n_(a_n), b_n_(b_n) {}
+
+  std::size_t a_n() const noexcept { return a_n_; }
+  std::size_t b_n() const noexcept { return b_n_; }
+
+  // Record a hit against cross bin {a, b}.
+  void sample(std::size_t a, std::size_t b) noexcept {
+    CoverPoint::sample(a * b_n_ + b);
+  }
+
+  void report(std::ostream& os) const override;
+
+ private:
+  std::size_t a_n_;
+  std::size_t b_n_;
+};
+
+// Collection of cover points associated with some test.
+class CoverageModel {
+ public:
+  explicit CoverageModel() = default;
+
+  // Construct cover points owned by the model.
+  CoverPoint* add_point(const std::string& name, std::size_t bins_n,
+    CoverPoint::count_type goal = 1);
+  CrossPoint* add_cross(const std::string& name, std::size_t a_n,
+    std::size_t b_n, CoverPoint::count_type goal = 1);
+
+  CoverPoint* lookup(const std::string& name) const noexcept;
+
+  // All cover points have reached their goals.
+  bool goals_met() const noexcept;
+
+  // Accumulate coverage from another model. Points absent from this model
+  // are created in the likeness of their counterparts (crosses remain
+  // crosses). Points which differ in kind, shape or goal are rejected.
+  void merge(const CoverageModel& rhs);
+
+  // Persist model to/from disk. Loading merges the database into the
+  // current model such that results from parallel jobs may be accumulated;
+  // as for merge, a database incompatible with the model is rejected.
+  void save(const std::string& fn) const;
+  void load(const std::string& fn);
+
+  void report(std::ostream& os) const;
+
+ private:
+  std::vector<std::unique_ptr<CoverPoint>> points_;
+};
+
+}  // namespace tb::coverage
+
+#endif  // TB_TB_COVERAGE_H
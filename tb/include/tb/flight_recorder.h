@@ -0,0 +1,71 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_FLIGHT_RECORDER_H
+#define TB_TB_FLIGHT_RECORDER_H
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <string>
+
+#include "tb/ring_buffer.h"
+#include "verilated_vcd_c.h"
+
+namespace tb {
+
+// In-memory VCD sink retaining only the most recent history of a trace. The
+// trace is rotated (VerilatedVcdC::openNext) periodically by its owner; each
+// rotation opens a new segment, which Verilator begins with a full dump of
+// all signals, such that any retained segment is self-contained. Only the
+// most recent segments are retained and are written out, behind the
+// (retained) declarations, on demand.
+class FlightRecorder final : public VerilatedVcdFile {
+ public:
+  explicit FlightRecorder(std::size_t segments_n = 2);
+
+  // Segments are retained in memory; the file name is unused.
+  bool open(const std::string&) override;
+  void close() override;
+  ssize_t write(const char* bufp, ssize_t len) override;
+
+  // Write the retained history as a VCD file.
+  void save(const std::string& fn) const;
+
+ private:
+  // Declarations (the VCD header), emitted once on initial open.
+  std::string header_;
+  bool header_done_{false};
+
+  // Most recent segments; the tail is the segment currently being written.
+  RingBuffer<std::string> segments_;
+  std::size_t segments_n_;
+};
+
+}  // namespace tb
+
+#endif  // TB_TB_FLIGHT_RECORDER_H
@@ -0,0 +1,106 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_MEM_H
+#define TB_TB_MEM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tb::mem {
+
+// Storage of a generic_sram/generic_bram instance whose memory model is
+// backed by the testbench (TB_CFG__MEM_MODEL: DPI). Words are held as 32-bit
+// chunks, least-significant first, such that the contents may be preloaded
+// (poke) or inspected (peek) without involving the UUT.
+class Memory {
+ public:
+  static constexpr std::size_t CHUNK_W = 32;
+
+  explicit Memory(
+    const std::string& path, std::size_t word_w, std::size_t words_n);
+
+  // Hierarchical path of the instance (as %m).
+  const std::string& path() const noexcept { return path_; }
+
+  std::size_t word_w() const noexcept { return word_w_; }
+
+  std::size_t words_n() const noexcept { return words_n_; }
+
+  std::size_t chunks_n() const noexcept { return chunks_n_; }
+
+  // Chunk accessors (DPI); out-of-range accesses read zero and discard
+  // writes, as the array model.
+  std::uint32_t read(std::size_t addr, std::size_t i) const noexcept;
+
+  void write(std::size_t addr, std::size_t i, std::uint32_t v) noexcept;
+
+  // Field [lsb + w - 1:lsb] (w <= 64) of word at addr.
+  std::uint64_t peek(std::size_t addr, std::size_t lsb, std::size_t w) const;
+
+  void poke(std::size_t addr, std::size_t lsb, std::size_t w, std::uint64_t v);
+
+  // Set all words to v.
+  void fill(std::uint32_t v) noexcept;
+
+ private:
+  void check_field(std::size_t addr, std::size_t lsb, std::size_t w) const;
+
+  std::string path_;
+  std::size_t word_w_;
+  std::size_t words_n_;
+  std::size_t chunks_n_;
+  std::vector<std::uint32_t> data_;
+};
+
+inline class MemoryRegistry {
+ public:
+  explicit MemoryRegistry() = default;
+
+  // Create storage for the instance at path; on re-elaboration of a model,
+  // prior storage at the same path is superseded.
+  Memory* create(
+    const std::string& path, std::size_t word_w, std::size_t words_n);
+
+  // Most recently created memory whose path contains fragment, or nullptr if
+  // none (for example, when the memory model is not "DPI").
+  Memory* lookup(std::string_view fragment) const;
+
+  // Registered memories, in order of creation.
+  std::vector<Memory*> memories() const;
+
+ private:
+  std::vector<std::unique_ptr<Memory>> memories_;
+} MEMORY_REGISTRY;
+
+}  // namespace tb::mem
+
+#endif  // TB_TB_MEM_H
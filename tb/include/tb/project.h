@@ -28,6 +28,11 @@
 #ifndef TB_TB_PROJECT_H
 #define TB_TB_PROJECT_H
 
+#include <stdexcept>
+
+#include "tb/alloc.h"
+#include "tb/clock.h"
+#include "tb/flight_recorder.h"
 #include "tb/tb.h"
 #include "vsupport.h"
 
@@ -43,6 +48,17 @@ class GenericSynchronousTest : public ProjectTestBase {
 
   virtual void on_negedge(ProjectInstanceBase* instance) {};
 
+  // Test has reached its objectives and simulation may terminate early.
+  // Polled once per cycle.
+  virtual bool is_complete() const noexcept { return false; }
+
+  // Upper bound on the number of simulation cycles run post-reset.
+  virtual std::size_t max_cycles_n() const noexcept { return 1000; }
+
+  // Test must complete (is_complete) within the cycle budget; otherwise,
+  // the test runs for the budget and exhausting it is not a failure.
+  virtual bool requires_completion() const noexcept { return false; }
+
  public:
   virtual ~GenericSynchronousTest() = default;
 };
@@ -64,6 +80,9 @@ class GenericSynchronousProjectInstance : public ProjectInstanceBase {
     bool reset_active_high = false;
   } opts;
 
+  // Period of the primary clock (set_clk), in units of simulation time.
+  static constexpr ClockScheduler::time_type CLK_PERIOD = 10;
+
  public:
   explicit GenericSynchronousProjectInstance(const std::string& name);
   virtual ~GenericSynchronousProjectInstance();
@@ -72,9 +91,18 @@ class GenericSynchronousProjectInstance : public ProjectInstanceBase {
   virtual void initialize() override;
   virtual void run(ProjectTestBase* test) override;
   virtual void finalize() override;
+  virtual void on_failure() override;
   virtual void eval() override;
   virtual std::size_t cycle();
 
+  std::size_t simulated_cycles_n() const noexcept override {
+    return clk_cycles_n_;
+  }
+
+  std::size_t model_bytes_n() const noexcept override {
+    return model_bytes_n_;
+  }
+
  protected:
   virtual void set_clk(bool v) = 0;
   virtual void set_rst(bool v) = 0;
@@ -85,8 +113,13 @@ class GenericSynchronousProjectInstance : public ProjectInstanceBase {
   // Perform reset sequence
   void perform_reset_sequence();
 
-  // Step n clock cycles (with ticks per cycle)
-  void step_cycles_n(std::size_t cycles_n = 1, std::size_t ticks_n = 10);
+  // Step n cycles of the primary clock.
+  void step_cycles_n(std::size_t cycles_n = 1);
+
+  // Clocks of the instance; the primary clock is added on elaboration.
+  // Further clocks (and their callbacks) may be added thereafter, and before
+  // the first cycle is stepped.
+  ClockScheduler& clocks() noexcept { return clocks_; }
 
  private:
   bool vcd_en_{true};
@@ -94,14 +127,44 @@ class GenericSynchronousProjectInstance : public ProjectInstanceBase {
   // Construct VCD trace
   void construct_trace();
 
+  // Construct VCD trace retained in-memory by the flight recorder.
+  void construct_flight_recorder();
+
   void destruct_trace();
 
-  void evaluate_timestep();
+  // Write flight-recorder history (if enabled) upon failure; only the
+  // history preceding the first failure is written.
+  void save_flight_recorder();
+
+  void evaluate_timestep(ClockScheduler::time_type t);
+
+  // Advance to, and evaluate, the next edge of any clock.
+  void step_edge();
+
+  // Falling edge of the primary clock.
+  void on_clk_negedge();
+
+  // Raise any error reported by the UUT.
+  void check_errors();
 
   std::unique_ptr<UUT> uut_;
   std::unique_ptr<VerilatedContext> uut_ctxt_;
+  // Must outlive the trace which writes to it.
+  std::unique_ptr<FlightRecorder> uut_recorder_;
   std::unique_ptr<VerilatedVcdC> uut_vcd_;
 
+  // Cycles elapsed since the last flight-recorder rotation.
+  std::size_t recorder_cycles_n_{0};
+  bool recorder_saved_{false};
+
+  ClockScheduler clocks_;
+
+  // Cycles of the primary clock elapsed.
+  std::size_t clk_cycles_n_{0};
+
+  // Heap allocated on construction of the UUT (allocation tracking only).
+  std::size_t model_bytes_n_{0};
+
   GenericSynchronousTest* test_{nullptr};
 
   State state_;
@@ -125,22 +188,67 @@ void GenericSynchronousProjectInstance<UUT>::elaborate() {
   if constexpr (UUT::traceCapable) {
     uut_ctxt_->traceEverOn(true);
   }
+  const std::size_t bytes_n = alloc::total_counts().bytes_n;
   uut_ = std::make_unique<UUT>(uut_ctxt_.get(), "uut");
+  model_bytes_n_ = alloc::total_counts().bytes_n - bytes_n;
+
+  // Primary clock; the first rising edge follows a low half-period.
+  const std::size_t clk = clocks_.add_clock(
+    "clk", CLK_PERIOD, CLK_PERIOD / 2, [this](bool v) { set_clk(v); });
+  clocks_.on_edge(
+    clk, ClockScheduler::Edge::Falling, [this]() { on_clk_negedge(); });
   if constexpr (UUT::traceCapable) {
     if (tb_options.enable_waveform_dumping && vcd_en_) {
       construct_trace();
+    } else if (tb_options.flight_recorder_cycles_n != 0 && vcd_en_) {
+      construct_flight_recorder();
     }
   }
 }
 
 template <typename UUT>
-void GenericSynchronousProjectInstance<UUT>::evaluate_timestep() {
-  uut_ctxt_->timeInc(1);
+void GenericSynchronousProjectInstance<UUT>::evaluate_timestep(
+  ClockScheduler::time_type t) {
+  uut_ctxt_->time(t);
   uut_->eval();
   if constexpr (UUT::traceCapable) {
-    if (tb_options.enable_waveform_dumping && vcd_en_) {
-      uut_vcd_->dump(uut_ctxt_->time());
+    if (uut_vcd_) {
+      uut_vcd_->dump(t);
+    }
+  }
+}
+
+template <typename UUT>
+void GenericSynchronousProjectInstance<UUT>::step_edge() {
+  clocks_.advance();
+  evaluate_timestep(clocks_.now());
+
+  if (clocks_.dispatch()) {
+    // Settle inputs driven by callbacks ahead of the next edge, unless
+    // coincident with it.
+    const ClockScheduler::time_type t = clocks_.now() + 1;
+    if (t < clocks_.next_time()) {
+      evaluate_timestep(t);
+    }
+  }
+}
+
+template <typename UUT>
+void GenericSynchronousProjectInstance<UUT>::on_clk_negedge() {
+  if (state_ == State::POST_RESET) {
+    {
+      alloc::HotPathScope hot_path;
+      test_->on_negedge(this);
     }
+    alloc::end_cycle();
+  }
+  ++clk_cycles_n_;
+}
+
+template <typename UUT>
+void GenericSynchronousProjectInstance<UUT>::check_errors() {
+  if (std::optional<vsupport::Error> error = vsupport::take_error(); error) {
+    throw std::runtime_error("UUT error: " + error->to_string());
   }
 }
 
@@ -151,6 +259,25 @@ void GenericSynchronousProjectInstance<UUT>::construct_trace() {
   uut_vcd_->open("uut_trace.vcd");
 }
 
+template <typename UUT>
+void GenericSynchronousProjectInstance<UUT>::construct_flight_recorder() {
+  uut_recorder_ = std::make_unique<FlightRecorder>();
+  uut_vcd_ = std::make_unique<VerilatedVcdC>(uut_recorder_.get());
+  uut_->trace(uut_vcd_.get(), 99);
+  uut_vcd_->open("uut_trace.vcd");
+}
+
+template <typename UUT>
+void GenericSynchronousProjectInstance<UUT>::save_flight_recorder() {
+  if (!uut_recorder_ || recorder_saved_) {
+    return;
+  }
+
+  uut_vcd_->flush();
+  uut_recorder_->save("uut_trace.vcd");
+  recorder_saved_ = true;
+}
+
 template <typename UUT>
 void GenericSynchronousProjectInstance<UUT>::destruct_trace() {
   // Allow some window period.
@@ -180,11 +307,28 @@ void GenericSynchronousProjectInstance<UUT>::run(ProjectTestBase* test) {
 
   // Perform initialization.
   state_ = State::IN_RESET;
+  alloc::set_phase(alloc::Phase::Reset);
   perform_reset_sequence();
 
-  // Run main test
+  // Run main test until completion or until the cycle budget is exhausted.
   state_ = State::POST_RESET;
-  step_cycles_n(1000);
+  alloc::set_phase(alloc::Phase::Run);
+  for (std::size_t i = 0; i < test_->max_cycles_n(); ++i) {
+    if (test_->is_complete()) {
+      return;
+    }
+    step_cycles_n(1);
+  }
+
+  if (test_->requires_completion() && !test_->is_complete()) {
+    throw std::runtime_error("Cycle budget exhausted before test completion");
+  }
+}
+
+template <typename UUT>
+void GenericSynchronousProjectInstance<UUT>::on_failure() {
+  // Write the history preceding the failure.
+  save_flight_recorder();
 }
 
 template <typename UUT>
@@ -204,24 +348,21 @@ void GenericSynchronousProjectInstance<UUT>::perform_reset_sequence() {
 
 template <typename UUT>
 void GenericSynchronousProjectInstance<UUT>::step_cycles_n(
-  std::size_t cycles_n, std::size_t ticks_n) {
-  const std::size_t half_ticks_n = ticks_n / 2;
-
+  std::size_t cycles_n) {
   while (cycles_n--) {
-    // Rising edge
-    set_clk(true);
-    for (std::size_t i = 0; i < half_ticks_n; ++i) {
-      evaluate_timestep();
+    // Evaluate edges (of all clocks) up to and including the falling edge of
+    // the primary clock.
+    for (const std::size_t n = clk_cycles_n_; n == clk_cycles_n_;) {
+      step_edge();
     }
 
-    // Falling edge
-    set_clk(false);
-    for (std::size_t i = 0; i < half_ticks_n; ++i) {
-      evaluate_timestep();
-      if (i == 0 && (state_ == State::POST_RESET)) {
-        // Invoke on_negedge callback
-        test_->on_negedge(this);
-      }
+    check_errors();
+
+    if (uut_recorder_ &&
+        (++recorder_cycles_n_ == tb_options.flight_recorder_cycles_n)) {
+      // Rotate trace; retained segments span at least the last N cycles.
+      uut_vcd_->openNext(false);
+      recorder_cycles_n_ = 0;
     }
   }
 }
@@ -233,7 +374,12 @@ void GenericSynchronousProjectInstance<UUT>::finalize() {
 
   // Wind-down simulation and close trace if enabled.
   if constexpr (UUT::traceCapable) {
-    if (uut_vcd_) {
+    if (uut_recorder_) {
+      // Success; history is discarded.
+      uut_vcd_->close();
+      uut_vcd_.reset();
+      uut_recorder_.reset();
+    } else if (uut_vcd_) {
       destruct_trace();
     }
   }
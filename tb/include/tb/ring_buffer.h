@@ -0,0 +1,100 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_RING_BUFFER_H
+#define TB_TB_RING_BUFFER_H
+
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+namespace tb {
+
+// Fixed-capacity FIFO. Storage is allocated once on construction (capacity
+// is rounded up to the next power-of-two) such that push/pop operations
+// never allocate.
+template <typename T>
+class RingBuffer {
+ public:
+  using value_type = T;
+
+  explicit RingBuffer(std::size_t capacity)
+      : data_(std::bit_ceil(capacity)), mask_(data_.size() - 1) {}
+
+  std::size_t capacity() const noexcept { return data_.size(); }
+  std::size_t size() const noexcept { return wr_ - rd_; }
+  bool empty() const noexcept { return wr_ == rd_; }
+  bool full() const noexcept { return size() == capacity(); }
+
+  // Push to tail; returns false (and discards t) if full.
+  bool push_back(const T& t) noexcept {
+    if (full()) {
+      return false;
+    }
+    data_[wr_++ & mask_] = t;
+    return true;
+  }
+
+  // Element at the tail, to be populated in place and then pushed by
+  // push_back(); its storage is that of an element previously popped, such
+  // that elements owning storage (e.g. vectors) reuse their capacity.
+  T& back_slot() noexcept { return data_[wr_ & mask_]; }
+
+  // Push the element populated at back_slot(); returns false if full.
+  bool push_back() noexcept {
+    if (full()) {
+      return false;
+    }
+    ++wr_;
+    return true;
+  }
+
+  T& front() noexcept { return data_[rd_ & mask_]; }
+  const T& front() const noexcept { return data_[rd_ & mask_]; }
+
+  // Element at position i relative to head.
+  T& operator[](std::size_t i) noexcept { return data_[(rd_ + i) & mask_]; }
+  const T& operator[](std::size_t i) const noexcept {
+    return data_[(rd_ + i) & mask_];
+  }
+
+  void pop_front() noexcept { ++rd_; }
+
+  void clear() noexcept { rd_ = wr_ = 0; }
+
+ private:
+  std::vector<T> data_;
+  std::size_t mask_;
+
+  // Free-running read/write pointers.
+  std::size_t rd_{0};
+  std::size_t wr_{0};
+};
+
+}  // namespace tb
+
+#endif  // TB_TB_RING_BUFFER_H
@@ -0,0 +1,324 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_SCHED_H
+#define TB_TB_SCHED_H
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace tb::sched {
+
+// Forwards:
+class Event;
+class Scheduler;
+
+// Sequence: a coroutine which suspends upon the clock edges, cycle counts,
+// conditions or events of a Scheduler. A sequence may await a nested
+// sequence, which then runs to completion before the sequence resumes;
+// exceptions raised by the nested sequence propagate to the awaiter.
+//
+//   tb::sched::Task drive(tb::sched::Scheduler& s) {
+//     start(true);
+//     co_await s.negedge();
+//     start(false);
+//     if (!co_await s.until([&] { return done(); }, 1000)) {
+//       throw std::runtime_error("Timeout");
+//     }
+//   }
+//
+// Coroutine parameters are retained by the frame; pass by value anything
+// which must outlive the caller's expression.
+class Task {
+ public:
+  struct promise_type;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+ private:
+  // On completion, resume the awaiter (if any) in place.
+  struct FinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(handle_type h) noexcept;
+    void await_resume() const noexcept {}
+  };
+
+ public:
+  struct promise_type {
+    Task get_return_object() noexcept {
+      return Task{handle_type::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() noexcept {
+      exception = std::current_exception();
+    }
+
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+  };
+
+  struct Awaiter {
+    bool await_ready() const noexcept { return !h || h.done(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> c) noexcept {
+      h.promise().continuation = c;
+      return h;
+    }
+    void await_resume() const {
+      if (h && h.promise().exception) {
+        std::rethrow_exception(h.promise().exception);
+      }
+    }
+
+    handle_type h;
+  };
+
+  Task(Task&& t) noexcept : h_(std::exchange(t.h_, {})) {}
+  Task& operator=(Task&& t) noexcept {
+    if (this != &t) {
+      destroy();
+      h_ = std::exchange(t.h_, {});
+    }
+    return *this;
+  }
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  ~Task() { destroy(); }
+
+  bool done() const noexcept { return !h_ || h_.done(); }
+
+  Awaiter operator co_await() const& noexcept { return Awaiter{h_}; }
+
+ private:
+  friend class Scheduler;
+
+  explicit Task(handle_type h) noexcept : h_(h) {}
+
+  std::exception_ptr exception() const noexcept {
+    return h_ ? h_.promise().exception : nullptr;
+  }
+
+  void destroy() noexcept {
+    if (h_) {
+      h_.destroy();
+      h_ = {};
+    }
+  }
+
+  handle_type h_;
+};
+
+inline std::coroutine_handle<> Task::FinalAwaiter::await_suspend(
+  handle_type h) noexcept {
+  if (std::coroutine_handle<> c = h.promise().continuation; c) {
+    return c;
+  }
+  return std::noop_coroutine();
+}
+
+// Cooperative scheduler of the sequences run on an instance. Time advances
+// in whole cycles, at the falling edge of the clock; sequences resumed in
+// a cycle run in the order in which they became ready.
+//
+// Sequences suspended on cycle counts or events are held in a wake-up queue
+// (or on the event) and are not visited until due; only conditions
+// (until) are polled, once per cycle. Stretches in which no sequence is due
+// may therefore be stepped at once (see quiescent_cycles_n and run).
+class Scheduler {
+  friend class Event;
+
+  // Sequence suspended on a polled condition.
+  struct Poll {
+    virtual bool test() = 0;
+
+    std::size_t deadline;
+    std::coroutine_handle<> h;
+    bool satisfied{false};
+
+   protected:
+    ~Poll() = default;
+  };
+
+ public:
+  class CyclesAwaiter {
+   public:
+    explicit CyclesAwaiter(Scheduler& s, std::size_t n) noexcept
+        : s_(s), n_(n) {}
+
+    bool await_ready() const noexcept { return n_ == 0; }
+    void await_suspend(std::coroutine_handle<> h) {
+      s_.wake_at(s_.now_ + n_, h);
+    }
+    void await_resume() const noexcept {}
+
+   private:
+    Scheduler& s_;
+    std::size_t n_;
+  };
+
+  template <typename Pred>
+  class UntilAwaiter : Poll {
+   public:
+    explicit UntilAwaiter(Scheduler& s, Pred pred, std::size_t timeout_n)
+        : s_(s), pred_(std::move(pred)) {
+      this->deadline = (timeout_n > (NEVER - s.now_)) ? NEVER
+                                                      : (s.now_ + timeout_n);
+    }
+
+    bool await_ready() { return this->satisfied = pred_(); }
+    void await_suspend(std::coroutine_handle<> h) {
+      this->h = h;
+      s_.polls_.push_back(this);
+    }
+    bool await_resume() const noexcept { return this->satisfied; }
+
+   private:
+    bool test() override { return pred_(); }
+
+    Scheduler& s_;
+    Pred pred_;
+  };
+
+  static constexpr std::size_t NEVER = std::numeric_limits<std::size_t>::max();
+
+  explicit Scheduler() = default;
+  Scheduler(const Scheduler&) = delete;
+  Scheduler& operator=(const Scheduler&) = delete;
+
+  // Current cycle.
+  std::size_t now() const noexcept { return now_; }
+
+  // All sequences have completed.
+  bool done() const noexcept { return tasks_.empty(); }
+
+  // Spawn sequence; it starts within the current (or next) step.
+  void spawn(Task t);
+
+  // Suspend for n cycles.
+  CyclesAwaiter cycles(std::size_t n) noexcept {
+    return CyclesAwaiter{*this, n};
+  }
+
+  // Suspend until the next falling clock edge, at which the testbench
+  // samples outputs and drives inputs.
+  CyclesAwaiter negedge() noexcept { return cycles(1); }
+
+  // Suspend until pred() holds, evaluated once per cycle, or until timeout_n
+  // cycles have elapsed; yields true if pred() holds. Prefer an Event where
+  // the condition is raised by another sequence.
+  template <typename Pred>
+  UntilAwaiter<Pred> until(Pred pred, std::size_t timeout_n = NEVER) {
+    return UntilAwaiter<Pred>{*this, std::move(pred), timeout_n};
+  }
+
+  // Cycles which may elapse before any sequence is next due; NEVER if no
+  // sequence is due at all.
+  std::size_t quiescent_cycles_n() const noexcept;
+
+  // Advance by n cycles (which must not exceed the quiescent cycles by more
+  // than one) and resume all sequences due. Exceptions raised by a sequence
+  // propagate to the caller.
+  void advance(std::size_t n = 1);
+
+  // Run until all sequences have completed, invoking step(n) to advance
+  // the simulation by n cycles; quiescent stretches are stepped at once.
+  template <typename Step>
+  void run(Step&& step) {
+    advance(0);
+    while (!done()) {
+      const std::size_t quiescent_n = quiescent_cycles_n();
+      if (quiescent_n == NEVER) {
+        throw std::runtime_error("Sequences deadlocked; none are due");
+      }
+      step(quiescent_n + 1);
+      advance(quiescent_n + 1);
+    }
+  }
+
+ private:
+  struct Wake {
+    std::size_t cycle;
+    std::size_t seq;
+    std::coroutine_handle<> h;
+
+    // Earliest first, then in order of suspension.
+    bool operator>(const Wake& w) const noexcept {
+      return (cycle != w.cycle) ? (cycle > w.cycle) : (seq > w.seq);
+    }
+  };
+
+  void wake_at(std::size_t cycle, std::coroutine_handle<> h);
+
+  // Remove completed sequences; raise the first exception encountered.
+  void reap();
+
+  std::size_t now_{0};
+  std::size_t seq_{0};
+
+  std::priority_queue<Wake, std::vector<Wake>, std::greater<Wake>> wakes_;
+  std::vector<Poll*> polls_;
+  std::vector<std::coroutine_handle<>> ready_;
+  std::vector<Task> tasks_;
+};
+
+// Event upon which sequences suspend until notified; waiters are resumed
+// within the step in which the event is notified (or the next, if notified
+// outside of a step), and are not otherwise visited.
+class Event {
+  struct Awaiter {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> h) {
+      e.waiters_.push_back(h);
+    }
+    void await_resume() const noexcept {}
+
+    Event& e;
+  };
+
+ public:
+  explicit Event(Scheduler& s) : s_(s) {}
+
+  // Resume all sequences awaiting the event.
+  void notify();
+
+  Awaiter operator co_await() noexcept { return Awaiter{*this}; }
+
+ private:
+  Scheduler& s_;
+  std::vector<std::coroutine_handle<>> waiters_;
+};
+
+}  // namespace tb::sched
+
+#endif  // TB_TB_SCHED_H
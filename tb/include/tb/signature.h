@@ -0,0 +1,56 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_SIGNATURE_H
+#define TB_TB_SIGNATURE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tb {
+
+// Incremental CRC-64 signature (CRC-64/XZ: ECMA-182 polynomial, reflected,
+// initial value and final XOR of all ones) over a byte stream.
+class Crc64 {
+ public:
+  explicit Crc64() = default;
+
+  void reset() noexcept { crc_ = ~std::uint64_t{0}; }
+
+  void update(const void* data, std::size_t n) noexcept;
+
+  void update(std::uint64_t v) noexcept;
+
+  std::uint64_t value() const noexcept { return ~crc_; }
+
+ private:
+  std::uint64_t crc_{~std::uint64_t{0}};
+};
+
+}  // namespace tb
+
+#endif  // TB_TB_SIGNATURE_H
@@ -0,0 +1,138 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_SPSC_QUEUE_H
+#define TB_TB_SPSC_QUEUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace tb {
+
+// Bounded, lock-free queue between exactly one producer and one consumer
+// thread, in fixed (power-of-two) storage. Each side caches the index of
+// the other, such that the shared indices are read only when the queue
+// appears full (or empty). A blocked consumer sleeps, and is woken by the
+// producer only when it has announced itself as waiting.
+template <typename T>
+class SpscQueue {
+  // Destructive interference size; producer and consumer state are kept on
+  // separate cache lines.
+  static constexpr std::size_t CACHE_LINE = 64;
+
+  // Attempts by a blocking consumer before it sleeps.
+  static constexpr std::size_t SPIN_N = 1024;
+
+ public:
+  explicit SpscQueue(std::size_t capacity)
+      : slots_(std::bit_ceil(capacity)), mask_(slots_.size() - 1) {}
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  std::size_t capacity() const noexcept { return slots_.size(); }
+
+  // (Producer) Enqueue t; returns false (and leaves t intact) if full.
+  bool try_push(T& t) {
+    const std::size_t wr = wr_.load(std::memory_order_relaxed);
+    if ((wr - rd_cached_) == slots_.size()) {
+      rd_cached_ = rd_.load(std::memory_order_acquire);
+      if ((wr - rd_cached_) == slots_.size()) {
+        return false;
+      }
+    }
+    slots_[wr & mask_] = std::move(t);
+    // Sequentially consistent with waiting_ (see pop), such that either the
+    // consumer observes the entry or the producer observes the waiter.
+    wr_.store(wr + 1, std::memory_order_seq_cst);
+    if (waiting_.load(std::memory_order_seq_cst)) {
+      wr_.notify_one();
+    }
+    return true;
+  }
+
+  // (Producer) Enqueue t; yields while full.
+  void push(T t) {
+    while (!try_push(t)) {
+      std::this_thread::yield();
+    }
+  }
+
+  // (Consumer) Dequeue into t; returns false if empty.
+  bool try_pop(T& t) {
+    const std::size_t rd = rd_.load(std::memory_order_relaxed);
+    if (rd == wr_cached_) {
+      wr_cached_ = wr_.load(std::memory_order_acquire);
+      if (rd == wr_cached_) {
+        return false;
+      }
+    }
+    t = std::move(slots_[rd & mask_]);
+    rd_.store(rd + 1, std::memory_order_release);
+    return true;
+  }
+
+  // (Consumer) Dequeue into t; blocks while empty.
+  void pop(T& t) {
+    for (std::size_t i = 0; i < SPIN_N; ++i) {
+      if (try_pop(t)) {
+        return;
+      }
+    }
+    while (!try_pop(t)) {
+      waiting_.store(true, std::memory_order_seq_cst);
+      const std::size_t rd = rd_.load(std::memory_order_relaxed);
+      if (wr_.load(std::memory_order_seq_cst) == rd) {
+        wr_.wait(rd, std::memory_order_acquire);
+      }
+      waiting_.store(false, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::vector<T> slots_;
+  std::size_t mask_;
+
+  // Producer state.
+  alignas(CACHE_LINE) std::atomic<std::size_t> wr_{0};
+  std::size_t rd_cached_{0};
+
+  // Consumer state.
+  alignas(CACHE_LINE) std::atomic<std::size_t> rd_{0};
+  std::size_t wr_cached_{0};
+
+  // Consumer is (about to be) blocked; read by the producer on each push.
+  alignas(CACHE_LINE) std::atomic<bool> waiting_{false};
+};
+
+}  // namespace tb
+
+#endif  // TB_TB_SPSC_QUEUE_H
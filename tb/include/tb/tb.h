@@ -43,6 +43,18 @@ namespace tb {
 inline struct Options {
   bool enable_waveform_dumping{false};
 
+  // Flight-recorder depth (in cycles); when non-zero, the trace is retained
+  // in memory and written only upon failure. Superseded by full waveform
+  // dumping.
+  std::size_t flight_recorder_cycles_n{0};
+
+  // Account heap allocations per phase and per cycle (see tb/alloc.h). In
+  // strict mode, allocations by the test (on_negedge) are fatal once the
+  // warm-up (in cycles) has elapsed.
+  bool enable_alloc_tracking{false};
+  bool enable_alloc_strict{false};
+  std::size_t alloc_warmup_cycles_n{0};
+
 } tb_options;
 
 #define P_MACRO_BEGIN do {
@@ -78,10 +90,28 @@ inline struct Options {
   } __tb_project_add_instance_ ##__project_class ##__name {}
 // clang-format on
 
+// Registers the instance __name of a parameter matrix (see generate_project);
+// __project_instance_template is specialized on the Verilated module and the
+// configuration (cfg/<instance>.h) of the instance.
+// clang-format off
+#define TB_PROJECT_ADD_MATRIX_INSTANCE(__project_class,                      \
+                                       __project_instance_template, __name)  \
+  using tb_project_matrix_instance_##__name =                                \
+      __project_instance_template<V##__name, cfg::__name>;                   \
+  TB_PROJECT_ADD_INSTANCE(__project_class, __name,                           \
+                          tb_project_matrix_instance_##__name);
+// clang-format on
+
+// Registers all instances of the parameter matrix of the project, as
+// enumerated by the generated header "matrix/<project>.h".
+#define TB_PROJECT_ADD_MATRIX(__project_class, __project_instance_template) \
+  TB_MATRIX_INSTANCES(TB_PROJECT_ADD_MATRIX_INSTANCE, __project_class,     \
+                      __project_instance_template)
+
 // clang-format off
 #define TB_PROJECT_ADD_TEST(__project_class, __name,                         \
      __project_instance_test)                                                \
-  class tb_project_add_test_helper_##__project_class {                       \
+  class tb_project_add_test_helper_##__project_class##__name {               \
     struct InstanceBuilder : public tb::ProjectTestBuilderBase {             \
       std::unique_ptr<tb::ProjectTestBase> construct(                        \
           const std::string& args) const override {                          \
@@ -90,12 +120,12 @@ inline struct Options {
       }                                                                      \
     };                                                                       \
    public:                                                                   \
-    explicit tb_project_add_test_helper_##__project_class() {                \
+    explicit tb_project_add_test_helper_##__project_class##__name() {        \
       auto p = tb::PROJECT_REGISTRY.lookup(#__project_class);                \
       p->add_test_builder(#__name,                                           \
                           std::make_unique<InstanceBuilder>());              \
     }                                                                        \
-  } __tb_project_add_test_##__project_class {}
+  } __tb_project_add_test_##__project_class##__name {}
 // clang-format on
 
 // clang-format off
@@ -131,8 +161,20 @@ class ProjectInstanceBase {
   virtual void run(ProjectTestBase* test) {}
   virtual void finalize() {}
 
+  // Failure of the test (a mismatch, or an error raised during simulation
+  // or finalization); diagnostics of the failure may be recorded. May be
+  // invoked more than once; the test is failed by its caller.
+  virtual void on_failure() {}
+
   virtual void eval() {}
 
+  // Cycles simulated (of the primary clock), including reset.
+  virtual std::size_t simulated_cycles_n() const noexcept { return 0; }
+
+  // Heap footprint (in bytes) of the model, as allocated on its
+  // construction; zero unless allocation tracking is enabled.
+  virtual std::size_t model_bytes_n() const noexcept { return 0; }
+
  private:
   // Design name.
   std::string name_;
@@ -199,6 +241,9 @@ class ProjectBuilderBase {
 
   ProjectTestBuilderBase* lookup_test_builder(const std::string& test_name);
 
+  // Names of the registered instances, in lexicographic order.
+  std::vector<std::string> instance_names() const;
+
  private:
   // Design name.
   std::string name_;
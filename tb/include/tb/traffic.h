@@ -0,0 +1,91 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_TB_TRAFFIC_H
+#define TB_TB_TRAFFIC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tb::traffic {
+
+// Per-cycle activity pattern of one side of a stream (for example, TVALID
+// of a source or TREADY of a sink). Patterns are generated once, on
+// construction, into a bit buffer which is replayed cyclically, such that
+// the per-cycle cost is a single load.
+//
+// Profiles are constructed from a specification, as passed through test
+// arguments:
+//
+//   full                   Always active.
+//   bernoulli:<p>          Active with probability p, independently per cycle.
+//   markov:<a>:<b>         Bursty on/off; active bursts end with probability
+//                          a and idle gaps end with probability b per cycle
+//                          (mean burst 1/a, mean gap 1/b).
+//   periodic:<on>:<off>    Active for 'on' cycles, then idle for 'off'.
+//   replay:<file>          Replay of a file of '0'/'1' characters (others are
+//                          ignored).
+//
+class Profile {
+ public:
+  // Length of generated (random) patterns, in cycles.
+  static constexpr std::size_t PATTERN_N = 1 << 16;
+
+  static Profile from_spec(const std::string& spec);
+
+  static Profile full();
+  static Profile bernoulli(double p);
+  static Profile markov(double a, double b);
+  static Profile periodic(std::size_t on, std::size_t off);
+  static Profile replay(const std::string& fn);
+
+  // Activity of the current cycle; advances to the next.
+  bool next() noexcept {
+    const bool b = (bits_[i_ >> 6] >> (i_ & 63)) & 1;
+    if (++i_ == n_) {
+      i_ = 0;
+    }
+    return b;
+  }
+
+  // Pattern length (cycles) and fraction of cycles active.
+  std::size_t size() const noexcept { return n_; }
+  double duty() const noexcept;
+
+ private:
+  explicit Profile(const std::vector<bool>& pattern);
+
+  std::vector<std::uint64_t> bits_;
+  std::size_t n_;
+  std::size_t i_{0};
+};
+
+}  // namespace tb::traffic
+
+#endif  // TB_TB_TRAFFIC_H
@@ -28,6 +28,11 @@
 #ifndef TB_TB_VSUPPORT_H
 #define TB_TB_VSUPPORT_H
 
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <type_traits>
+
 #include "verilated.h"
 #include "verilated_vcd_c.h"
 
@@ -40,9 +45,47 @@ T from_v(vluint8_t v) {
   return (v != 0);
 }
 
+// Extract field [lsb + w - 1:lsb] (w <= 32) from a packed Verilated signal;
+// either an integral type or, for signals wider than 64b, a VlWide<>.
+template <typename T>
+vluint32_t bits(const T& v, std::size_t lsb, std::size_t w) noexcept {
+  const vluint32_t mask =
+    (w < 32) ? ((vluint32_t{1} << w) - 1) : ~vluint32_t{0};
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<vluint32_t>(v >> lsb) & mask;
+  } else {
+    const std::size_t word = lsb / 32;
+    const std::size_t offset = lsb % 32;
+    vluint64_t x = static_cast<vluint64_t>(v[word]) >> offset;
+    if ((offset + w) > 32) {
+      x |= static_cast<vluint64_t>(v[word + 1]) << (32 - offset);
+    }
+    return static_cast<vluint32_t>(x) & mask;
+  }
+}
+
+// Error reported by the UUT (by way of tb_error).
+struct Error {
+  std::string filename;
+  int lineno;
+  std::string msg;
+
+  std::string to_string() const;
+};
+
+// Retrieve (and clear) the first error reported by the UUT, if any. Errors
+// are raised by the testbench, outside of the evaluation of the model.
+std::optional<Error> take_error();
+
 }  // namespace tb::vsupport
 
 // DPI support functions
 extern "C" int tb_error(const char* filename, int lineno, const char* msg);
 
+extern "C" void* tb_mem_create(const char* path, int word_w, int words_n);
+
+extern "C" int tb_mem_read(void* mem, int addr, int i);
+
+extern "C" void tb_mem_write(void* mem, int addr, int i, int v);
+
 #endif  // TB_TB_VSUPPORT_H
\ No newline at end of file
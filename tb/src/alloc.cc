@@ -0,0 +1,273 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/alloc.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+
+namespace tb::alloc {
+
+namespace {
+
+// Accounting is consulted on every allocation; counters are therefore
+// relaxed atomics, as allocations may be made by any thread (for example,
+// the conv golden model).
+std::atomic<bool> enabled_{false};
+std::atomic<std::size_t> phase_{static_cast<std::size_t>(Phase::Elaborate)};
+std::atomic<std::size_t> allocs_n_[PHASES_N];
+std::atomic<std::size_t> bytes_n_[PHASES_N];
+
+bool strict_{false};
+std::size_t warmup_cycles_n_{0};
+
+// Armed (strict mode) once warm-up has elapsed.
+std::atomic<bool> armed_{false};
+
+// Per cycle accounting (Run phase); of the simulation thread alone, such
+// that allocations of worker threads are not attributed to the cycle in
+// which they happen to fall.
+std::size_t cycles_n_{0};
+std::size_t cycle_allocs_n_last_{0};
+std::size_t cycle_allocs_n_max_{0};
+std::size_t sim_run_allocs_n_{0};
+
+thread_local bool is_sim_thread_{false};
+thread_local bool in_hot_path_{false};
+
+const char* to_string(Phase p) noexcept {
+  switch (p) {
+    case Phase::Elaborate: return "elaborate";
+    case Phase::Reset: return "reset";
+    case Phase::Run: return "run";
+    case Phase::Finalize: return "finalize";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+namespace detail {
+
+void on_alloc(std::size_t n) noexcept {
+  if (!enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  const std::size_t p = phase_.load(std::memory_order_relaxed);
+  allocs_n_[p].fetch_add(1, std::memory_order_relaxed);
+  bytes_n_[p].fetch_add(n, std::memory_order_relaxed);
+  if (is_sim_thread_ && (p == static_cast<std::size_t>(Phase::Run))) {
+    ++sim_run_allocs_n_;
+  }
+  if (in_hot_path_ && armed_.load(std::memory_order_relaxed)) {
+    // Formatted without allocation; the run cannot proceed.
+    std::fprintf(stderr,
+      "Error: allocation of %zu bytes in on_negedge after %zu cycles "
+      "(strict allocation mode)\n",
+      n, cycles_n_);
+    std::abort();
+  }
+}
+
+}  // namespace detail
+
+void enable(bool strict, std::size_t warmup_cycles_n) noexcept {
+  strict_ = strict;
+  warmup_cycles_n_ = warmup_cycles_n;
+  is_sim_thread_ = true;
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+bool enabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+void set_phase(Phase p) noexcept {
+  phase_.store(static_cast<std::size_t>(p), std::memory_order_relaxed);
+  if (p != Phase::Run) {
+    armed_.store(false, std::memory_order_relaxed);
+  }
+}
+
+Counts phase_counts(Phase p) noexcept {
+  const std::size_t i = static_cast<std::size_t>(p);
+  return Counts{allocs_n_[i].load(std::memory_order_relaxed),
+    bytes_n_[i].load(std::memory_order_relaxed)};
+}
+
+Counts total_counts() noexcept {
+  Counts c;
+  for (std::size_t i = 0; i < PHASES_N; ++i) {
+    const Counts p = phase_counts(static_cast<Phase>(i));
+    c.allocs_n += p.allocs_n;
+    c.bytes_n += p.bytes_n;
+  }
+  return c;
+}
+
+void end_cycle() noexcept {
+  if (!enabled()) {
+    return;
+  }
+  const std::size_t allocs_n = sim_run_allocs_n_;
+  if (cycles_n_ >= warmup_cycles_n_) {
+    // Cycles of warm-up are excluded from the per-cycle maximum.
+    cycle_allocs_n_max_ =
+      std::max(cycle_allocs_n_max_, allocs_n - cycle_allocs_n_last_);
+  }
+  cycle_allocs_n_last_ = allocs_n;
+  if ((++cycles_n_ >= warmup_cycles_n_) && strict_) {
+    armed_.store(true, std::memory_order_relaxed);
+  }
+}
+
+HotPathScope::HotPathScope() noexcept { in_hot_path_ = true; }
+
+HotPathScope::~HotPathScope() { in_hot_path_ = false; }
+
+ColdPathScope::ColdPathScope() noexcept : was_in_hot_path_(in_hot_path_) {
+  in_hot_path_ = false;
+}
+
+ColdPathScope::~ColdPathScope() { in_hot_path_ = was_in_hot_path_; }
+
+void report(std::ostream& os, std::size_t model_bytes_n) {
+  if (!enabled()) {
+    return;
+  }
+  for (std::size_t i = 0; i < PHASES_N; ++i) {
+    const Counts c = phase_counts(static_cast<Phase>(i));
+    os << "Allocations: phase=" << to_string(static_cast<Phase>(i))
+       << " allocs=" << c.allocs_n << " bytes=" << c.bytes_n << "\n";
+  }
+
+  // Peak resident set size (KiB on Linux).
+  struct rusage usage {};
+  getrusage(RUSAGE_SELF, &usage);
+
+  // Per cycle, of the simulation thread.
+  os << "Allocations: cycles=" << cycles_n_ << " allocs_per_cycle="
+     << ((cycles_n_ != 0)
+           ? (static_cast<double>(sim_run_allocs_n_) / cycles_n_)
+           : 0.0)
+     << " max_allocs_per_cycle=" << cycle_allocs_n_max_
+     << " (after " << warmup_cycles_n_ << " warm-up)"
+     << " model_bytes=" << model_bytes_n << " rss_kb=" << usage.ru_maxrss
+     << "\n";
+}
+
+}  // namespace tb::alloc
+
+// Replacement allocation functions; all allocations (by operator new) are
+// accounted, when enabled, and deferred to malloc.
+
+namespace {
+
+void* allocate(std::size_t n) {
+  tb::alloc::detail::on_alloc(n);
+  for (;;) {
+    if (void* p = std::malloc(n ? n : 1)) {
+      return p;
+    }
+    std::new_handler h = std::get_new_handler();
+    if (!h) {
+      throw std::bad_alloc();
+    }
+    h();
+  }
+}
+
+void* allocate(std::size_t n, std::align_val_t al) {
+  tb::alloc::detail::on_alloc(n);
+  const std::size_t a = static_cast<std::size_t>(al);
+  // aligned_alloc requires a size that is a multiple of the alignment.
+  const std::size_t sz = ((std::max<std::size_t>(n, 1) + a - 1) / a) * a;
+  for (;;) {
+    if (void* p = std::aligned_alloc(a, sz)) {
+      return p;
+    }
+    std::new_handler h = std::get_new_handler();
+    if (!h) {
+      throw std::bad_alloc();
+    }
+    h();
+  }
+}
+
+}  // namespace
+
+void* operator new(std::size_t n) { return allocate(n); }
+
+void* operator new[](std::size_t n) { return allocate(n); }
+
+void* operator new(std::size_t n, std::align_val_t al) {
+  return allocate(n, al);
+}
+
+void* operator new[](std::size_t n, std::align_val_t al) {
+  return allocate(n, al);
+}
+
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept {
+  try {
+    return allocate(n);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept {
+  try {
+    return allocate(n);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
@@ -0,0 +1,61 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/args.h"
+
+namespace tb {
+
+TestArgs::TestArgs(const std::string& args) {
+  std::size_t pos = 0;
+  while (pos < args.size()) {
+    std::size_t end = args.find(',', pos);
+    if (end == std::string::npos) {
+      end = args.size();
+    }
+
+    const std::string kv{args.substr(pos, end - pos)};
+    if (!kv.empty()) {
+      if (const std::size_t eq = kv.find('='); eq != std::string::npos) {
+        args_[kv.substr(0, eq)] = kv.substr(eq + 1);
+      } else {
+        // Flag argument.
+        args_[kv] = "1";
+      }
+    }
+    pos = end + 1;
+  }
+}
+
+std::optional<std::string> TestArgs::get(const std::string& key) const {
+  if (auto it = args_.find(key); it != args_.end()) {
+    return it->second;
+  }
+  // Otherwise, argument was not found.
+  return std::nullopt;
+}
+
+}  // namespace tb
@@ -0,0 +1,221 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/axis.h"
+
+#include <algorithm>
+#include <bit>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace tb::axis {
+
+void Log2Histogram::sample(std::uint64_t v) noexcept {
+  const std::size_t k = std::min<std::size_t>(std::bit_width(v), BUCKETS_N - 1);
+  ++buckets_[k];
+  ++n_;
+  sum_ += v;
+  min_ = std::min(min_, v);
+  max_ = std::max(max_, v);
+}
+
+void Log2Histogram::report(std::ostream& os, const std::string& units) const {
+  os << "    n=" << n_ << " min=" << min() << " max=" << max()
+     << " mean=" << std::fixed << std::setprecision(2) << mean() << " "
+     << units << "\n";
+  for (std::size_t k = 0; k < BUCKETS_N; ++k) {
+    if (buckets_[k] == 0) {
+      continue;
+    }
+    const std::uint64_t lo = k ? (std::uint64_t{1} << (k - 1)) : 0;
+    const std::uint64_t hi = (std::uint64_t{1} << k) - 1;
+    os << "    [" << std::setw(6) << lo << ", " << std::setw(6) << hi
+       << "]: " << buckets_[k] << "\n";
+  }
+}
+
+Monitor::Monitor(const std::string& name, const Ports& ports,
+  std::size_t window_n, std::size_t pixels_per_beat)
+    : name_(name), ports_(ports), ppb_(pixels_per_beat), window_n_(window_n) {
+  if (!ports_.valid || !ports_.ready) {
+    throw std::runtime_error("AXI-Stream monitor requires VALID/READY: " + name);
+  }
+}
+
+const Handshake& Monitor::sample() noexcept {
+  hs_.valid = read(ports_.valid);
+  hs_.ready = read(ports_.ready);
+  hs_.last = read(ports_.last);
+  hs_.user = read(ports_.user);
+
+  ++cycles_n_;
+  ready_n_ += hs_.ready;
+  stall_n_ += (hs_.valid && !hs_.ready);
+  bubble_n_ += (!hs_.valid && hs_.ready);
+  if (hs_.fire()) {
+    ++beats_n_;
+    sof_n_ += hs_.user;
+    eol_n_ += hs_.last;
+  }
+
+  // Throughput windows.
+  window_beats_n_ += hs_.fire();
+  if (++window_cycles_n_ == window_n_) {
+    const double rate = ratio(window_beats_n_ * ppb_, window_n_);
+    window_min_ = std::min(window_min_, rate);
+    window_max_ = std::max(window_max_, rate);
+    ++windows_n_;
+    window_cycles_n_ = 0;
+    window_beats_n_ = 0;
+  }
+  return hs_;
+}
+
+void Monitor::report(std::ostream& os) const {
+  os << std::fixed << std::setprecision(3);
+  os << "  " << name_ << ":\n"
+     << "    cycles=" << cycles_n_ << " beats=" << beats_n_
+     << " pixels=" << pixels_n() << " sof=" << sof_n_ << " eol=" << eol_n_
+     << "\n"
+     << "    throughput=" << throughput() << " pixels/cycle"
+     << " (window " << window_n_ << ": min=" << window_min()
+     << " max=" << window_max() << ")\n"
+     << "    ready_duty=" << ready_duty() << " stall(valid&!ready)="
+     << stall_n_ << " bubble(!valid&ready)=" << bubble_n_ << "\n";
+}
+
+PathMonitor::PathMonitor(const std::string& name, const Ports& ingress,
+  const Ports& egress, std::size_t pixels_per_beat, std::size_t window_n,
+  std::size_t inflight_n)
+    : name_(name),
+      ingress_(name + ".ingress", ingress, window_n, pixels_per_beat),
+      egress_(name + ".egress", egress, window_n, pixels_per_beat),
+      inflight_(inflight_n),
+      ppb_(pixels_per_beat),
+      window_n_(window_n) {}
+
+void PathMonitor::sample() noexcept {
+  const Handshake& in = ingress_.sample();
+  const Handshake& out = egress_.sample();
+  const std::uint64_t cycle = egress_.cycles_n();
+
+  // Latency tracking.
+  if (in.fire() && !inflight_.push_back(cycle)) {
+    ++inflight_overflow_n_;
+  }
+  if (out.fire()) {
+    if (inflight_.empty()) {
+      ++unmatched_n_;
+    } else {
+      latency_.sample(cycle - inflight_.front());
+      inflight_.pop_front();
+    }
+  }
+
+  // Stall attribution; ingress state is taken one path latency earlier.
+  ingress_valid_hist_ = (ingress_valid_hist_ << 1) | in.valid;
+  const std::size_t delay = latency_.count()
+    ? std::min<std::uint64_t>(latency_.min(), HISTORY_N - 1) : 0;
+  const bool in_valid = (ingress_valid_hist_ >> delay) & 1;
+
+  bool eligible = false;
+  if (out.fire()) {
+    eligible = true;
+  } else if (!out.ready) {
+    ++downstream_n_;
+  } else if (!in_valid) {
+    ++upstream_n_;
+  } else {
+    ++dut_n_;
+    eligible = true;
+  }
+
+  sample_throughput(eligible, out.fire());
+}
+
+void PathMonitor::sample_throughput(bool eligible, bool fire) noexcept {
+  // Exclude pipeline fill.
+  warm_ = warm_ || fire;
+  if (!warm_ || !eligible) {
+    return;
+  }
+
+  window_beats_n_ += fire;
+  if (++window_cycles_n_ < window_n_) {
+    return;
+  }
+
+  const double rate = double(window_beats_n_ * ppb_) / window_n_;
+  if (rate < min_rate_) {
+    if (violations_n_++ == 0) {
+      first_violation_cycle_ = egress_.cycles_n();
+    }
+  }
+  worst_rate_ = std::min(worst_rate_, rate);
+  ++rate_windows_n_;
+  window_cycles_n_ = 0;
+  window_beats_n_ = 0;
+}
+
+void PathMonitor::check() const {
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  if (violations_n_ != 0) {
+    ss << name_ << ": throughput assertion failed; " << violations_n_
+       << " window(s) below " << min_rate_ << " pixels/cycle (worst "
+       << worst_rate_ << ", first at monitor cycle " << first_violation_cycle_
+       << ")";
+    throw std::runtime_error(ss.str());
+  }
+  if (inflight_overflow_n_ != 0 || unmatched_n_ != 0) {
+    ss << name_ << ": ingress/egress beat mismatch (overflow="
+       << inflight_overflow_n_ << ", unmatched=" << unmatched_n_ << ")";
+    throw std::runtime_error(ss.str());
+  }
+}
+
+void PathMonitor::report(std::ostream& os) const {
+  os << "Stream monitor '" << name_ << "':\n";
+  ingress_.report(os);
+  egress_.report(os);
+  os << "  latency (ingress -> egress):\n";
+  latency_.report(os, "cycles");
+  os << "  egress stall attribution:\n"
+     << "    upstream=" << upstream_n_ << " downstream=" << downstream_n_
+     << " dut=" << dut_n_ << "\n";
+  if (min_rate_ > 0.0) {
+    os << "  throughput assertion (>= " << min_rate_
+       << " pixels/cycle): " << (violations_n_ ? "FAIL" : "PASS");
+    if (rate_windows_n_ != 0) {
+      os << " (worst window " << worst_rate_ << ")";
+    }
+    os << "\n";
+  }
+}
+
+}  // namespace tb::axis
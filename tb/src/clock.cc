@@ -0,0 +1,159 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/clock.h"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <stdexcept>
+
+namespace tb {
+
+std::size_t ClockScheduler::add_clock(const std::string& name,
+  time_type period, time_type phase, std::function<void(bool)> drive) {
+  if (started_) {
+    throw std::runtime_error("Clocks must be added before the first edge");
+  }
+  if ((period < 2) || (period % 2) != 0) {
+    throw std::runtime_error("Clock period must be even: " + name);
+  }
+
+  Clock c;
+  c.name = name;
+  c.half_period = period / 2;
+  c.next = phase;
+  c.drive = std::move(drive);
+  clocks_.push_back(std::move(c));
+  return clocks_.size() - 1;
+}
+
+void ClockScheduler::on_edge(
+  std::size_t clk, Edge edge, std::function<void()> cb) {
+  Clock& c = clocks_.at(clk);
+  (edge == Edge::Rising ? c.on_rise : c.on_fall).push_back(std::move(cb));
+}
+
+ClockScheduler::time_type ClockScheduler::next_time() const noexcept {
+  time_type t = ~time_type{0};
+  for (const Clock& c : clocks_) {
+    t = std::min(t, c.next);
+  }
+  return t;
+}
+
+void ClockScheduler::build() {
+  if (clocks_.empty()) {
+    throw std::runtime_error("No clocks have been added");
+  }
+
+  // All edges fall on multiples of the quantum; pending edges lie at most
+  // one half-period ahead, hence within one revolution of the wheel.
+  time_type q = 0;
+  time_type span = 0;
+  for (const Clock& c : clocks_) {
+    q = std::gcd(q, std::gcd(c.half_period, c.next));
+    span = std::max(span, std::max(c.half_period, c.next));
+  }
+  quantum_ = q;
+  const std::size_t slots_n =
+    std::max<std::size_t>(64, std::bit_ceil(span / quantum_ + 1));
+  heads_.assign(slots_n, NIL);
+  occupied_.assign(slots_n / 64, 0);
+  fired_.reserve(clocks_.size());
+
+  for (std::size_t i = 0; i < clocks_.size(); ++i) {
+    insert(i);
+  }
+  started_ = true;
+}
+
+void ClockScheduler::insert(std::size_t clk) {
+  const std::size_t i = slot(clocks_[clk].next);
+  clocks_[clk].link = heads_[i];
+  heads_[i] = clk;
+  occupied_[i / 64] |= std::uint64_t{1} << (i % 64);
+}
+
+std::size_t ClockScheduler::scan(std::size_t i) const noexcept {
+  const std::size_t words_n = occupied_.size();
+  std::size_t w = i / 64;
+  std::uint64_t bits = occupied_[w] & (~std::uint64_t{0} << (i % 64));
+  // At least one slot is occupied; wraps at most once.
+  while (bits == 0) {
+    w = (w + 1) % words_n;
+    bits = occupied_[w];
+  }
+  return w * 64 + std::countr_zero(bits);
+}
+
+std::size_t ClockScheduler::advance() {
+  // The first edge may be coincident with time zero.
+  std::size_t i;
+  if (!started_) {
+    build();
+    i = scan(slot(now_));
+  } else {
+    i = scan((slot(now_) + 1) & (heads_.size() - 1));
+  }
+
+  // Detach the pending clocks of the slot, all of which share an edge time.
+  std::size_t clk = heads_[i];
+  heads_[i] = NIL;
+  occupied_[i / 64] &= ~(std::uint64_t{1} << (i % 64));
+  now_ = clocks_[clk].next;
+
+  fired_.clear();
+  for (; clk != NIL; clk = clocks_[clk].link) {
+    fired_.push_back(clk);
+  }
+  std::sort(fired_.begin(), fired_.end());
+
+  for (std::size_t f : fired_) {
+    Clock& c = clocks_[f];
+    c.level = !c.level;
+    c.drive(c.level);
+    c.next += c.half_period;
+    insert(f);
+  }
+  return fired_.size();
+}
+
+bool ClockScheduler::dispatch() {
+  bool dispatched = false;
+  for (std::size_t f : fired_) {
+    // Level following the edge; high on the rising edge.
+    const Clock& c = clocks_[f];
+    for (const std::function<void()>& cb : c.level ? c.on_rise : c.on_fall) {
+      cb();
+      dispatched = true;
+    }
+  }
+  return dispatched;
+}
+
+}  // namespace tb
@@ -0,0 +1,245 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/coverage.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace tb::coverage {
+
+namespace {
+
+// Kind, shape and goal of a cover point; points are compatible (for merge)
+// only if all are identical. Plain points are of shape {bins_n, 1}.
+struct Shape {
+  bool is_cross;
+  std::size_t a_n;
+  std::size_t b_n;
+  CoverPoint::count_type goal;
+
+  bool operator==(const Shape&) const = default;
+};
+
+Shape shape_of(const CoverPoint& p) noexcept {
+  if (const CrossPoint* c = dynamic_cast<const CrossPoint*>(&p)) {
+    return Shape{true, c->a_n(), c->b_n(), c->goal()};
+  }
+  return Shape{false, p.bins_n(), 1, p.goal()};
+}
+
+}  // namespace
+
+CoverPoint::CoverPoint(
+  const std::string& name, std::size_t bins_n, count_type goal)
+    : name_(name), goal_(goal) {
+  if (bins_n == 0 || goal == 0) {
+    throw std::runtime_error("Malformed cover point: " + name);
+  }
+  hits_.resize(bins_n, 0);
+  closed_.resize((bins_n + 63) / 64, 0);
+}
+
+void CoverPoint::add_hits(std::size_t bin, count_type n) noexcept {
+  const std::uint64_t sum = static_cast<std::uint64_t>(hits_[bin]) + n;
+  hits_[bin] = static_cast<count_type>(
+    std::min<std::uint64_t>(sum, std::numeric_limits<count_type>::max()));
+
+  if (!is_closed(bin) && (hits_[bin] >= goal_)) {
+    close(bin);
+  }
+}
+
+void CoverPoint::merge(const CoverPoint& rhs) {
+  if (rhs.bins_n() != bins_n()) {
+    throw std::runtime_error("Cover point shape mismatch on merge: " + name_);
+  }
+  if (rhs.goal() != goal()) {
+    throw std::runtime_error("Cover point goal mismatch on merge: " + name_);
+  }
+
+  for (std::size_t bin = 0; bin < bins_n(); ++bin) {
+    add_hits(bin, rhs.hits_[bin]);
+  }
+}
+
+void CoverPoint::report(std::ostream& os) const {
+  os << name_ << ": " << closed_n() << "/" << bins_n() << " bins closed\n";
+  for (std::size_t bin = 0; bin < bins_n(); ++bin) {
+    if (!is_closed(bin)) {
+      os << "  [" << bin << "] " << hits_[bin] << "/" << goal_ << "\n";
+    }
+  }
+}
+
+void CrossPoint::report(std::ostream& os) const {
+  os << name() << ": " << closed_n() << "/" << bins_n() << " bins closed\n";
+  for (std::size_t a = 0; a < a_n_; ++a) {
+    for (std::size_t b = 0; b < b_n_; ++b) {
+      const std::size_t bin = a * b_n_ + b;
+      if (!is_closed(bin)) {
+        os << "  [" << a << ", " << b << "] " << hits(bin) << "/" << goal()
+           << "\n";
+      }
+    }
+  }
+}
+
+CoverPoint* CoverageModel::add_point(
+  const std::string& name, std::size_t bins_n, CoverPoint::count_type goal) {
+  if (lookup(name)) {
+    throw std::runtime_error("Duplicate cover point: " + name);
+  }
+  points_.push_back(std::make_unique<CoverPoint>(name, bins_n, goal));
+  return points_.back().get();
+}
+
+CrossPoint* CoverageModel::add_cross(const std::string& name, std::size_t a_n,
+  std::size_t b_n, CoverPoint::count_type goal) {
+  if (lookup(name)) {
+    throw std::runtime_error("Duplicate cover point: " + name);
+  }
+  auto cross = std::make_unique<CrossPoint>(name, a_n, b_n, goal);
+  CrossPoint* p = cross.get();
+  points_.push_back(std::move(cross));
+  return p;
+}
+
+CoverPoint* CoverageModel::lookup(const std::string& name) const noexcept {
+  for (const std::unique_ptr<CoverPoint>& p : points_) {
+    if (p->name() == name) {
+      return p.get();
+    }
+  }
+  // Otherwise, cover point was not found.
+  return nullptr;
+}
+
+bool CoverageModel::goals_met() const noexcept {
+  for (const std::unique_ptr<CoverPoint>& p : points_) {
+    if (!p->goals_met()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void CoverageModel::merge(const CoverageModel& rhs) {
+  for (const std::unique_ptr<CoverPoint>& p : rhs.points_) {
+    const Shape shape{shape_of(*p)};
+    CoverPoint* lhs = lookup(p->name());
+    if (!lhs) {
+      lhs = shape.is_cross
+              ? add_cross(p->name(), shape.a_n, shape.b_n, shape.goal)
+              : add_point(p->name(), shape.a_n, shape.goal);
+    } else if (shape_of(*lhs) != shape) {
+      throw std::runtime_error(
+        "Incompatible cover point on merge: " + p->name());
+    }
+    lhs->merge(*p);
+  }
+}
+
+// Database format (one record per cover point):
+//
+//   point <name> <bins_n> <goal>
+//   <hits[0]> <hits[1]> ... <hits[bins_n - 1]>
+//
+// or, for crosses (bins in row-major order of {a, b}):
+//
+//   cross <name> <a_n> <b_n> <goal>
+//   <hits[0]> <hits[1]> ... <hits[a_n * b_n - 1]>
+//
+void CoverageModel::save(const std::string& fn) const {
+  std::ofstream of{fn};
+  if (!of) {
+    throw std::runtime_error("Unable to open coverage database: " + fn);
+  }
+
+  for (const std::unique_ptr<CoverPoint>& p : points_) {
+    const Shape shape{shape_of(*p)};
+    if (shape.is_cross) {
+      of << "cross " << p->name() << " " << shape.a_n << " " << shape.b_n;
+    } else {
+      of << "point " << p->name() << " " << p->bins_n();
+    }
+    of << " " << p->goal() << "\n";
+    for (std::size_t bin = 0; bin < p->bins_n(); ++bin) {
+      of << (bin ? " " : "") << p->hits(bin);
+    }
+    of << "\n";
+  }
+}
+
+void CoverageModel::load(const std::string& fn) {
+  std::ifstream is{fn};
+  if (!is) {
+    throw std::runtime_error("Unable to open coverage database: " + fn);
+  }
+
+  std::string tag, name;
+  while (is >> tag >> name) {
+    Shape shape{false, 0, 1, 0};
+    if (tag == "cross") {
+      shape.is_cross = true;
+      is >> shape.a_n >> shape.b_n;
+    } else if (tag == "point") {
+      is >> shape.a_n;
+    } else {
+      throw std::runtime_error("Malformed coverage database: " + fn);
+    }
+    if (!(is >> shape.goal)) {
+      throw std::runtime_error("Malformed coverage database: " + fn);
+    }
+
+    CoverPoint* p = lookup(name);
+    if (!p) {
+      p = shape.is_cross ? add_cross(name, shape.a_n, shape.b_n, shape.goal)
+                         : add_point(name, shape.a_n, shape.goal);
+    } else if (shape_of(*p) != shape) {
+      throw std::runtime_error("Incompatible cover point on load: " + name);
+    }
+
+    const std::size_t bins_n = shape.a_n * shape.b_n;
+    for (std::size_t bin = 0; bin < bins_n; ++bin) {
+      CoverPoint::count_type hits;
+      if (!(is >> hits)) {
+        throw std::runtime_error("Truncated coverage database: " + fn);
+      }
+      p->add_hits(bin, hits);
+    }
+  }
+}
+
+void CoverageModel::report(std::ostream& os) const {
+  for (const std::unique_ptr<CoverPoint>& p : points_) {
+    p->report(os);
+  }
+}
+
+}  // namespace tb::coverage
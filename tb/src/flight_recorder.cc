@@ -0,0 +1,86 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/flight_recorder.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+namespace tb {
+
+FlightRecorder::FlightRecorder(std::size_t segments_n)
+    : segments_(segments_n), segments_n_(segments_n) {}
+
+bool FlightRecorder::open(const std::string&) {
+  // Retire the oldest segment to make room for the next. Slots are reused,
+  // retaining their storage, such that steady-state operation does not
+  // allocate.
+  if (segments_.size() == segments_n_) {
+    segments_.pop_front();
+  }
+  segments_.push_back(std::string{});
+  return true;
+}
+
+void FlightRecorder::close() {}
+
+ssize_t FlightRecorder::write(const char* bufp, ssize_t len) {
+  std::string_view data{bufp, static_cast<std::size_t>(len)};
+  if (!header_done_) {
+    // Header is terminated by the end of the declarations; the remainder
+    // is data of the initial segment.
+    static constexpr std::string_view END_DEFINITIONS = "$enddefinitions $end";
+    header_.append(data);
+    if (const std::size_t pos = header_.find(END_DEFINITIONS);
+        pos != std::string::npos) {
+      const std::size_t end = header_.find('\n', pos);
+      if (end != std::string::npos) {
+        segments_[segments_.size() - 1].append(header_, end + 1);
+        header_.resize(end + 1);
+        header_done_ = true;
+      }
+    }
+    return len;
+  }
+
+  segments_[segments_.size() - 1].append(data);
+  return len;
+}
+
+void FlightRecorder::save(const std::string& fn) const {
+  std::ofstream os{fn, std::ios::binary};
+  if (!os) {
+    throw std::runtime_error("Unable to open waveform file: " + fn);
+  }
+  os << header_;
+  for (std::size_t i = 0; i < segments_.size(); ++i) {
+    os << segments_[i];
+  }
+}
+
+}  // namespace tb
@@ -0,0 +1,118 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/mem.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace tb::mem {
+
+Memory::Memory(
+  const std::string& path, std::size_t word_w, std::size_t words_n)
+    : path_(path), word_w_(word_w), words_n_(words_n),
+      chunks_n_((word_w + CHUNK_W - 1) / CHUNK_W),
+      data_(words_n * chunks_n_) {}
+
+std::uint32_t Memory::read(std::size_t addr, std::size_t i) const noexcept {
+  if ((addr >= words_n_) || (i >= chunks_n_)) {
+    return 0;
+  }
+  return data_[addr * chunks_n_ + i];
+}
+
+void Memory::write(std::size_t addr, std::size_t i, std::uint32_t v) noexcept {
+  if ((addr >= words_n_) || (i >= chunks_n_)) {
+    return;
+  }
+  data_[addr * chunks_n_ + i] = v;
+}
+
+std::uint64_t Memory::peek(
+  std::size_t addr, std::size_t lsb, std::size_t w) const {
+  check_field(addr, lsb, w);
+  std::uint64_t v = 0;
+  for (std::size_t b = 0; b < w; ++b) {
+    const std::size_t bit = lsb + b;
+    const std::uint32_t c = data_[addr * chunks_n_ + bit / CHUNK_W];
+    v |= static_cast<std::uint64_t>((c >> (bit % CHUNK_W)) & 1) << b;
+  }
+  return v;
+}
+
+void Memory::poke(
+  std::size_t addr, std::size_t lsb, std::size_t w, std::uint64_t v) {
+  check_field(addr, lsb, w);
+  for (std::size_t b = 0; b < w; ++b) {
+    const std::size_t bit = lsb + b;
+    std::uint32_t& c = data_[addr * chunks_n_ + bit / CHUNK_W];
+    const std::uint32_t m = std::uint32_t{1} << (bit % CHUNK_W);
+    c = ((v >> b) & 1) ? (c | m) : (c & ~m);
+  }
+}
+
+void Memory::fill(std::uint32_t v) noexcept {
+  std::fill(data_.begin(), data_.end(), v);
+}
+
+void Memory::check_field(
+  std::size_t addr, std::size_t lsb, std::size_t w) const {
+  if (addr >= words_n_) {
+    throw std::runtime_error(
+      path_ + ": address out of range: " + std::to_string(addr));
+  }
+  if ((w > 64) || ((lsb + w) > word_w_)) {
+    throw std::runtime_error(path_ + ": field out of range: [" +
+      std::to_string(lsb + w) + ":" + std::to_string(lsb) + "]");
+  }
+}
+
+Memory* MemoryRegistry::create(
+  const std::string& path, std::size_t word_w, std::size_t words_n) {
+  std::erase_if(memories_, [&](const auto& m) { return m->path() == path; });
+  memories_.push_back(std::make_unique<Memory>(path, word_w, words_n));
+  return memories_.back().get();
+}
+
+Memory* MemoryRegistry::lookup(std::string_view fragment) const {
+  for (auto it = memories_.rbegin(); it != memories_.rend(); ++it) {
+    if ((*it)->path().find(fragment) != std::string::npos) {
+      return it->get();
+    }
+  }
+  return nullptr;
+}
+
+std::vector<Memory*> MemoryRegistry::memories() const {
+  std::vector<Memory*> ms;
+  for (const auto& m : memories_) {
+    ms.push_back(m.get());
+  }
+  return ms;
+}
+
+}  // namespace tb::mem
@@ -25,6 +25,8 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //========================================================================== //
 
+#include <algorithm>
+
 #include "tb/tb.h"
 
 namespace tb {
@@ -62,4 +64,14 @@ ProjectTestBuilderBase* ProjectBuilderBase::lookup_test_builder(
   return nullptr;
 }
 
+std::vector<std::string> ProjectBuilderBase::instance_names() const {
+  std::vector<std::string> names;
+  names.reserve(instances_.size());
+  for (const auto& [name, builder] : instances_) {
+    names.push_back(name);
+  }
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
 }  // namespace tb
\ No newline at end of file
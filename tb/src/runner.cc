@@ -25,6 +25,12 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //========================================================================== //
 
+#include <sys/resource.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "tb/alloc.h"
 #include "tb/project.h"
 #include "tb/tb.h"
 
@@ -40,9 +46,19 @@ class DefaultProjectRunner final : public ProjectInstanceRunner {
 
  private:
   void execute();
+  void simulate();
+
+  // Report simulation performance; parsed by the regression runner.
+  void report_performance(double wall) const;
 };
 
 void DefaultProjectRunner::run() {
+  if (tb_options.enable_alloc_tracking) {
+    alloc::enable(
+      tb_options.enable_alloc_strict, tb_options.alloc_warmup_cycles_n);
+  }
+  alloc::set_phase(alloc::Phase::Elaborate);
+
   // Elaborate model.
   instance_->elaborate();
 
@@ -50,13 +66,30 @@ void DefaultProjectRunner::run() {
   instance_->initialize();
 
   // Run simulation
+  const auto start = std::chrono::steady_clock::now();
   execute();
+  const std::chrono::duration<double> wall =
+    std::chrono::steady_clock::now() - start;
+  report_performance(wall.count());
 
   // Finalize instance
+  const std::size_t model_bytes_n = instance_->model_bytes_n();
   instance_->finalize();
+  alloc::report(std::cout, model_bytes_n);
 }
 
 void DefaultProjectRunner::execute() {
+  try {
+    simulate();
+  } catch (...) {
+    // Failure of simulation or of test finalization; notify the instance
+    // such that diagnostics of the failure are retained.
+    instance_->on_failure();
+    throw;
+  }
+}
+
+void DefaultProjectRunner::simulate() {
   // Initialize test.
   test_->init(instance_);
 
@@ -81,9 +114,23 @@ void DefaultProjectRunner::execute() {
   }
 
   // Run finalization of test.
+  alloc::set_phase(alloc::Phase::Finalize);
   test_->fini(instance_);
 }
 
+void DefaultProjectRunner::report_performance(double wall) const {
+  const std::size_t cycles_n = instance_->simulated_cycles_n();
+
+  // Peak resident set size (KiB on Linux).
+  struct rusage usage {};
+  getrusage(RUSAGE_SELF, &usage);
+
+  std::cout << "Performance: cycles=" << cycles_n << " wall=" << wall
+            << " cycles_per_sec="
+            << ((wall > 0.0) ? (static_cast<double>(cycles_n) / wall) : 0.0)
+            << " rss_kb=" << usage.ru_maxrss << "\n";
+}
+
 std::unique_ptr<ProjectInstanceRunner> ProjectInstanceRunner::Build(
   Type t, ProjectInstanceBase* instance, ProjectTestBase* test) {
   std::unique_ptr<ProjectInstanceRunner> runner;
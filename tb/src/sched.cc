@@ -0,0 +1,112 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/sched.h"
+
+#include <algorithm>
+
+namespace tb::sched {
+
+void Scheduler::spawn(Task t) {
+  ready_.push_back(t.h_);
+  tasks_.push_back(std::move(t));
+}
+
+std::size_t Scheduler::quiescent_cycles_n() const noexcept {
+  if (!ready_.empty() || !polls_.empty()) {
+    // Conditions are polled on every cycle.
+    return 0;
+  }
+  if (wakes_.empty()) {
+    return NEVER;
+  }
+  return wakes_.top().cycle - now_ - 1;
+}
+
+void Scheduler::advance(std::size_t n) {
+  if (!wakes_.empty() && (wakes_.top().cycle < (now_ + n))) {
+    throw std::runtime_error("Scheduler advanced beyond a pending wake-up");
+  }
+  now_ += n;
+
+  // Sequences due in the current cycle.
+  while (!wakes_.empty() && (wakes_.top().cycle == now_)) {
+    ready_.push_back(wakes_.top().h);
+    wakes_.pop();
+  }
+
+  // Sequences whose condition holds, or has timed out.
+  std::size_t j = 0;
+  for (Poll* p : polls_) {
+    if (p->test()) {
+      p->satisfied = true;
+      ready_.push_back(p->h);
+    } else if (now_ >= p->deadline) {
+      p->satisfied = false;
+      ready_.push_back(p->h);
+    } else {
+      polls_[j++] = p;
+    }
+  }
+  polls_.resize(j);
+
+  // Resume; a resumed sequence may ready others within the current cycle.
+  for (std::size_t i = 0; i < ready_.size(); ++i) {
+    const std::coroutine_handle<> h = ready_[i];
+    h.resume();
+  }
+  ready_.clear();
+
+  reap();
+}
+
+void Scheduler::wake_at(std::size_t cycle, std::coroutine_handle<> h) {
+  wakes_.push(Wake{cycle, seq_++, h});
+}
+
+void Scheduler::reap() {
+  std::exception_ptr e;
+  std::erase_if(tasks_, [&e](const Task& t) {
+    if (!t.done()) {
+      return false;
+    }
+    if (!e) {
+      e = t.exception();
+    }
+    return true;
+  });
+  if (e) {
+    std::rethrow_exception(e);
+  }
+}
+
+void Event::notify() {
+  s_.ready_.insert(s_.ready_.end(), waiters_.begin(), waiters_.end());
+  waiters_.clear();
+}
+
+}  // namespace tb::sched
@@ -0,0 +1,159 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "tb/traffic.h"
+
+#include <bit>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "tb/tb.h"
+
+namespace tb::traffic {
+
+namespace {
+
+std::vector<std::string> split(const std::string& spec) {
+  std::vector<std::string> tokens;
+  std::istringstream is{spec};
+  for (std::string token; std::getline(is, token, ':');) {
+    tokens.push_back(token);
+  }
+  return tokens;
+}
+
+template <typename T>
+T parse(const std::string& spec, const std::string& token) {
+  T t{};
+  std::istringstream is{token};
+  if (!(is >> t) || !is.eof()) {
+    throw std::runtime_error("Malformed traffic profile: " + spec);
+  }
+  return t;
+}
+
+void check_probability(const std::string& spec, double p) {
+  if ((p < 0.0) || (p > 1.0)) {
+    throw std::runtime_error("Traffic profile probability out of range: " +
+                             spec);
+  }
+}
+
+}  // namespace
+
+Profile Profile::from_spec(const std::string& spec) {
+  const std::vector<std::string> tokens{split(spec)};
+  if (tokens.empty()) {
+    throw std::runtime_error("Malformed traffic profile: " + spec);
+  }
+
+  const std::string& kind = tokens.front();
+  if ((kind == "full") && (tokens.size() == 1)) {
+    return full();
+  } else if ((kind == "bernoulli") && (tokens.size() == 2)) {
+    const double p = parse<double>(spec, tokens[1]);
+    check_probability(spec, p);
+    return bernoulli(p);
+  } else if ((kind == "markov") && (tokens.size() == 3)) {
+    const double a = parse<double>(spec, tokens[1]);
+    const double b = parse<double>(spec, tokens[2]);
+    check_probability(spec, a);
+    check_probability(spec, b);
+    return markov(a, b);
+  } else if ((kind == "periodic") && (tokens.size() == 3)) {
+    return periodic(parse<std::size_t>(spec, tokens[1]),
+                    parse<std::size_t>(spec, tokens[2]));
+  } else if ((kind == "replay") && (tokens.size() == 2)) {
+    return replay(tokens[1]);
+  }
+  throw std::runtime_error("Unknown traffic profile: " + spec);
+}
+
+Profile Profile::full() { return Profile{std::vector<bool>(1, true)}; }
+
+Profile Profile::bernoulli(double p) {
+  std::vector<bool> pattern(PATTERN_N);
+  for (std::size_t i = 0; i < PATTERN_N; ++i) {
+    pattern[i] = RANDOM.random_bool(static_cast<float>(p));
+  }
+  return Profile{pattern};
+}
+
+Profile Profile::markov(double a, double b) {
+  std::vector<bool> pattern(PATTERN_N);
+  bool on = true;
+  for (std::size_t i = 0; i < PATTERN_N; ++i) {
+    pattern[i] = on;
+    on = on ? !RANDOM.random_bool(static_cast<float>(a))
+            : RANDOM.random_bool(static_cast<float>(b));
+  }
+  return Profile{pattern};
+}
+
+Profile Profile::periodic(std::size_t on, std::size_t off) {
+  if ((on + off) == 0) {
+    throw std::runtime_error("Periodic traffic profile has zero period");
+  }
+  std::vector<bool> pattern(on, true);
+  pattern.resize(on + off, false);
+  return Profile{pattern};
+}
+
+Profile Profile::replay(const std::string& fn) {
+  std::ifstream is{fn};
+  if (!is) {
+    throw std::runtime_error("Unable to open traffic profile: " + fn);
+  }
+  std::vector<bool> pattern;
+  for (char c; is.get(c);) {
+    if ((c == '0') || (c == '1')) {
+      pattern.push_back(c == '1');
+    }
+  }
+  if (pattern.empty()) {
+    throw std::runtime_error("Traffic profile is empty: " + fn);
+  }
+  return Profile{pattern};
+}
+
+Profile::Profile(const std::vector<bool>& pattern)
+    : bits_((pattern.size() + 63) / 64), n_(pattern.size()) {
+  for (std::size_t i = 0; i < n_; ++i) {
+    bits_[i >> 6] |= std::uint64_t{pattern[i]} << (i & 63);
+  }
+}
+
+double Profile::duty() const noexcept {
+  std::size_t active_n = 0;
+  for (std::uint64_t w : bits_) {
+    active_n += std::popcount(w);
+  }
+  return static_cast<double>(active_n) / n_;
+}
+
+}  // namespace tb::traffic
@@ -27,13 +27,56 @@
 
 #include "tb/vsupport.h"
 
+#include "tb/mem.h"
+
 namespace tb::vsupport {
 
+namespace {
+
+std::optional<Error> pending_error;
+
+}  // namespace
+
 vluint8_t to_v(bool b) { return b ? 1 : 0; }
 
+std::string Error::to_string() const {
+  return filename + ":" + std::to_string(lineno) + ": " + msg;
+}
+
+std::optional<Error> take_error() {
+  std::optional<Error> error;
+  error.swap(pending_error);
+  return error;
+}
+
 }  // namespace tb::vsupport
 
 // DPI support functions
 extern "C" int tb_error(const char* filename, int lineno, const char* msg) {
+  // Retain the first error; subsequent errors are typically consequential.
+  if (!tb::vsupport::pending_error) {
+    tb::vsupport::pending_error = tb::vsupport::Error{filename, lineno, msg};
+  }
   return 0;
 }
+
+// Memories are backed by tb::mem; addresses beyond the extent of the memory
+// read zero and discard writes.
+extern "C" void* tb_mem_create(const char* path, int word_w, int words_n) {
+  return tb::mem::MEMORY_REGISTRY.create(path, word_w, words_n);
+}
+
+extern "C" int tb_mem_read(void* mem, int addr, int i) {
+  if ((addr < 0) || (i < 0)) {
+    return 0;
+  }
+  return static_cast<int>(static_cast<tb::mem::Memory*>(mem)->read(addr, i));
+}
+
+extern "C" void tb_mem_write(void* mem, int addr, int i, int v) {
+  if ((addr < 0) || (i < 0)) {
+    return;
+  }
+  static_cast<tb::mem::Memory*>(mem)->write(
+    addr, i, static_cast<std::uint32_t>(v));
+}
@@ -26,6 +26,7 @@
 //========================================================================== //
 
 `include "common_defs.svh"
+`include "tb_pkg.svh"
 
 // Behavioural model of a generic/typical FPGA BRAM module.
 //
@@ -82,6 +83,129 @@ module generic_bram #(
 , input wire logic                           rnwb
 
 , output wire logic [WORD_W - 1:0]           doutb
+
+, input wire logic                           clk
 );
 
+logic                wea;
+logic                web;
+logic                rea;
+logic                reb;
+
+logic [WORD_W - 1:0] douta_r;
+logic [WORD_W - 1:0] doutb_r;
+
+assign wea = cea & ~rnwa;
+assign web = ceb & ~rnwb;
+assign rea = cea & rnwa;
+assign reb = ceb & rnwb;
+
+// A read colliding with a write on the opposite port returns the prior
+// contents ("DEFER_WRITE") or the data being written ("WRITE_FIRST").
+// Otherwise, dout is retained (HOLD_DOUT) or scrambled; in either case, a
+// write on the same port clobbers it. On a write/write collision, port A
+// prevails.
+
+if (tb_pkg::MEM_MODEL == "DPI") begin: dpi_GEN
+
+// Storage is held by the testbench (tb::mem), which may preload and inspect
+// it through the backdoor.
+localparam int CHUNKS_N = (WORD_W + 31) / 32;
+
+typedef logic [CHUNKS_N * 32 - 1:0] chunks_t;
+
+chandle mem_h;
+
+initial begin
+  mem_h = tb_pkg::tb_mem_create($sformatf("%m"), WORD_W, WORDS_N);
+end
+
+function automatic logic [WORD_W - 1:0] mem_read(logic [ADDR_W - 1:0] a);
+  chunks_t w;
+  for (int i = 0; i < CHUNKS_N; i++) begin
+    w[i * 32 +: 32] = tb_pkg::tb_mem_read(mem_h, int'(a), i);
+  end
+  return w[WORD_W - 1:0];
+endfunction
+
+function automatic void mem_write(
+    logic [ADDR_W - 1:0] a, logic [WORD_W - 1:0] d);
+  chunks_t w = chunks_t'(d);
+  for (int i = 0; i < CHUNKS_N; i++) begin
+    tb_pkg::tb_mem_write(mem_h, int'(a), i, w[i * 32 +: 32]);
+  end
+endfunction
+
+// Update process; the backing store is updated immediately, therefore reads
+// are sampled ahead of writes to retain the ordering of the array model.
+always_ff @(posedge clk) begin: update_PROC
+  if (rea) begin
+    douta_r <=
+        ((COLLISION == "WRITE_FIRST") && web && (addra == addrb))
+      ? dinb
+      : mem_read(addra);
+  end else if (wea || !HOLD_DOUT) begin
+    douta_r <= ~douta_r;
+  end
+
+  if (reb) begin
+    doutb_r <=
+        ((COLLISION == "WRITE_FIRST") && wea && (addra == addrb))
+      ? dina
+      : mem_read(addrb);
+  end else if (web || !HOLD_DOUT) begin
+    doutb_r <= ~doutb_r;
+  end
+
+  if (web) begin
+    mem_write(addrb, dinb);
+  end
+  if (wea) begin
+    mem_write(addra, dina);
+  end
+end: update_PROC
+
+end: dpi_GEN
+else begin: array_GEN
+
+logic [WORD_W - 1:0] mem [0:WORDS_N - 1];
+
+// Write update process.
+always_ff @(posedge clk) begin: write_PROC
+  if (web) begin
+    mem[addrb] <= dinb;
+  end
+  if (wea) begin
+    mem[addra] <= dina;
+  end
+end: write_PROC
+
+// Read update processes.
+always_ff @(posedge clk) begin: douta_PROC
+  if (rea) begin
+    douta_r <=
+        ((COLLISION == "WRITE_FIRST") && web && (addra == addrb))
+      ? dinb
+      : mem[addra];
+  end else if (wea || !HOLD_DOUT) begin
+    douta_r <= ~douta_r;
+  end
+end: douta_PROC
+
+always_ff @(posedge clk) begin: doutb_PROC
+  if (reb) begin
+    doutb_r <=
+        ((COLLISION == "WRITE_FIRST") && wea && (addra == addrb))
+      ? dina
+      : mem[addrb];
+  end else if (web || !HOLD_DOUT) begin
+    doutb_r <= ~doutb_r;
+  end
+end: doutb_PROC
+
+end: array_GEN
+
+assign douta = douta_r;
+assign doutb = doutb_r;
+
 endmodule : generic_bram
@@ -26,6 +26,7 @@
 //========================================================================== //
 
 `include "common_defs.svh"
+`include "tb_pkg.svh"
 
 // Behavioural model of a generic/typical ASIC SRAM module.
 //
@@ -57,11 +58,53 @@ module generic_sram #(
 , input wire logic                           clk
 );
 
-logic [WORD_W - 1:0] mem [0:WORDS_N - 1];
-
 logic                scrambled_dout_update_r;
 logic [WORD_W - 1:0] scrambled_dout_r;
 
+if (tb_pkg::MEM_MODEL == "DPI") begin: dpi_GEN
+
+// Storage is held by the testbench (tb::mem), which may preload and inspect
+// it through the backdoor.
+localparam int CHUNKS_N = (WORD_W + 31) / 32;
+
+typedef logic [CHUNKS_N * 32 - 1:0] chunks_t;
+
+chandle mem_h;
+
+initial begin
+  mem_h = tb_pkg::tb_mem_create($sformatf("%m"), WORD_W, WORDS_N);
+end
+
+function automatic logic [WORD_W - 1:0] mem_read(logic [ADDR_W - 1:0] a);
+  chunks_t w;
+  for (int i = 0; i < CHUNKS_N; i++) begin
+    w[i * 32 +: 32] = tb_pkg::tb_mem_read(mem_h, int'(a), i);
+  end
+  return w[WORD_W - 1:0];
+endfunction
+
+function automatic void mem_write(
+    logic [ADDR_W - 1:0] a, logic [WORD_W - 1:0] d);
+  chunks_t w = chunks_t'(d);
+  for (int i = 0; i < CHUNKS_N; i++) begin
+    tb_pkg::tb_mem_write(mem_h, int'(a), i, w[i * 32 +: 32]);
+  end
+endfunction
+
+// Update process; as the port is single ported, reads and writes are
+// mutually exclusive.
+always_ff @(posedge clk) begin: update_PROC
+  if (ce && ~rnw) begin
+    mem_write(addr, din);
+  end
+  dout <= (ce & rnw) ? mem_read(addr) : scrambled_dout_r;
+end: update_PROC
+
+end: dpi_GEN
+else begin: array_GEN
+
+logic [WORD_W - 1:0] mem [0:WORDS_N - 1];
+
 // Write update process.
 always_ff @(posedge clk) begin: write_PROC
   if (ce && ~rnw) begin
@@ -75,6 +118,8 @@ always_ff @(posedge clk) begin: read_PROC
   dout <= (ce & rnw) ? mem[addr] : scrambled_dout_r;
 end: read_PROC
 
+end: array_GEN
+
 // Block to scramble dout when not being updated.
 always_ff @(posedge clk) begin: scramble_dout_PROC
   scrambled_dout_update_r <= (ce & rnw);
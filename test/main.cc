@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "projects/projects.h"
+#include "tb/coverage.h"
 #include "tb/tb.h"
 
 #define P_TEST_ASSERT(__cond, __msg) \
@@ -69,8 +70,32 @@ void Job::validate() const {
   P_TEST_ASSERT(test_name.has_value(), "Test name is required");
 }
 
+// Merge coverage databases produced by (parallel) jobs.
+struct CoverageMerge {
+  // Merged output database.
+  std::string out;
+
+  // Input databases.
+  std::vector<std::string> ins;
+
+  void run() const;
+};
+
+void CoverageMerge::run() const {
+  tb::coverage::CoverageModel model;
+  for (const std::string& in : ins) {
+    model.load(in);
+  }
+  model.save(out);
+  model.report(std::cout);
+  std::cout << "Coverage goals " << (model.goals_met() ? "met" : "not met")
+            << "\n";
+}
+
 class Driver {
-  explicit Driver(const std::vector<Job>& jobs);
+  explicit Driver(const std::vector<Job>& jobs,
+    std::optional<CoverageMerge> merge,
+    std::optional<std::string> list_instances);
 
  public:
   static std::unique_ptr<Driver> from_args(int argc, char** argv);
@@ -81,15 +106,24 @@ class Driver {
   void run_job(const Job& job);
 
   std::vector<Job> jobs_;
+  std::optional<CoverageMerge> merge_;
+
+  // Project whose instances are to be listed.
+  std::optional<std::string> list_instances_;
 };
 
-Driver::Driver(const std::vector<Job>& jobs) : jobs_(jobs) {
+Driver::Driver(const std::vector<Job>& jobs,
+  std::optional<CoverageMerge> merge,
+  std::optional<std::string> list_instances)
+    : jobs_(jobs), merge_(merge), list_instances_(list_instances) {
   projects::register_projects();
 }
 
 std::unique_ptr<Driver> Driver::from_args(int argc, char** argv) {
   // Parse command line arguments to populate options.
   std::vector<Job> jobs;
+  std::optional<CoverageMerge> merge;
+  std::optional<std::string> list_instances;
   const std::vector<std::string_view> args(argv, argv + argc);
 
   std::size_t project_name_i, test_name_i, test_arg_i;
@@ -123,6 +157,36 @@ std::unique_ptr<Driver> Driver::from_args(int argc, char** argv) {
       current_job.test_args = args[++i];
     } else if (args[i] == "--enable-waveform-dumping") {
       tb::tb_options.enable_waveform_dumping = true;
+    } else if (args[i] == "--flight-recorder") {
+      // Flight-recorder depth (cycles).
+      P_TEST_ASSERT(
+        (i + 1) < args.size(), "Missing argument after --flight-recorder");
+      tb::tb_options.flight_recorder_cycles_n =
+        std::stoull(std::string{args[++i]});
+    } else if (args[i] == "--track-allocs") {
+      tb::tb_options.enable_alloc_tracking = true;
+    } else if (args[i] == "--strict-allocs") {
+      // Warm-up (cycles) after which test allocations are fatal.
+      P_TEST_ASSERT(
+        (i + 1) < args.size(), "Missing argument after --strict-allocs");
+      tb::tb_options.enable_alloc_tracking = true;
+      tb::tb_options.enable_alloc_strict = true;
+      tb::tb_options.alloc_warmup_cycles_n =
+        std::stoull(std::string{args[++i]});
+    } else if (args[i] == "--merge-coverage") {
+      // Coverage merge: <out> <in>...
+      P_TEST_ASSERT(
+        (i + 2) < args.size(), "Missing arguments after --merge-coverage");
+      merge = CoverageMerge{};
+      merge->out = args[++i];
+      while ((i + 1) < args.size() && !args[i + 1].starts_with("-")) {
+        merge->ins.emplace_back(args[++i]);
+      }
+    } else if (args[i] == "--list-instances") {
+      // Project whose instances are to be listed.
+      P_TEST_ASSERT(
+        (i + 1) < args.size(), "Missing argument after --list-instances");
+      list_instances = args[++i];
     } else if (args[i] == "--help" || args[i] == "-h") {
       std::cout << "Usage: testbench [options]\n"
                    "Options:\n"
@@ -130,15 +194,38 @@ std::unique_ptr<Driver> Driver::from_args(int argc, char** argv) {
                    "  -t/--test        \n"
                    "  -a/--args        \n"
                    "  --enable-waveform-dumping  Enable waveform dumping\n"
+                   "  --flight-recorder <n>      Retain the last n cycles of\n"
+                   "                             trace; dump only on failure\n"
+                   "  --track-allocs             Report heap allocations per\n"
+                   "                             phase and per cycle\n"
+                   "  --strict-allocs <n>        Abort on allocation by the\n"
+                   "                             test after n cycles\n"
+                   "  --merge-coverage <out> <in>...\n"
+                   "                             Merge coverage databases\n"
+                   "  --list-instances <project>\n"
+                   "                             List instances of project\n"
                    "  --help, -h                 Show this help message\n";
       std::exit(EXIT_SUCCESS);
     }
   }
 
-  return std::unique_ptr<Driver>(new Driver(jobs));
+  return std::unique_ptr<Driver>(new Driver(jobs, merge, list_instances));
 }
 
 int Driver::run() {
+  if (merge_) {
+    merge_->run();
+  }
+
+  if (list_instances_) {
+    tb::ProjectBuilderBase* project_builder{
+        tb::PROJECT_REGISTRY.lookup(*list_instances_)};
+    P_TEST_ASSERT(project_builder, "Unknown project: " + *list_instances_);
+    for (const std::string& name : project_builder->instance_names()) {
+      std::cout << name << "\n";
+    }
+  }
+
   for (const Job& job : jobs_) {
     job.validate();
     std::cout << "Running project: " << job.project_name << "\n";
@@ -168,7 +255,7 @@ void Driver::run_job(const Job& job) {
 
   // Construct project instance test.
   std::unique_ptr<tb::ProjectTestBase> test{
-      test_builder->construct(*job.test_args)};
+      test_builder->construct(job.test_args.value_or(""))};
   // Run test on instance.
   std::unique_ptr<tb::ProjectInstanceRunner> runner =
       tb::ProjectInstanceRunner::Build(tb::ProjectInstanceRunner::Type::Default,
@@ -0,0 +1,261 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include <cstdint>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "tb/axis.h"
+#include "tb/axis_vip.h"
+#include "tb/ring_buffer.h"
+#include "unit.h"
+
+namespace {
+
+// Interface state driven by a test, bound to a monitor.
+struct Interface {
+  std::uint8_t valid{0};
+  std::uint8_t ready{0};
+
+  tb::axis::Ports ports() const noexcept {
+    return tb::axis::Ports{.valid = &valid, .ready = &ready};
+  }
+};
+
+}  // namespace
+
+TB_UNIT_TEST(ring_buffer_capacity) {
+  tb::RingBuffer<int> rb(5);
+  TB_UNIT_EXPECT_EQ(rb.capacity(), 8u);
+  TB_UNIT_EXPECT(rb.empty());
+
+  for (int i = 0; i < 8; ++i) {
+    TB_UNIT_EXPECT(rb.push_back(i));
+  }
+  TB_UNIT_EXPECT(rb.full());
+  // Push to a full buffer is rejected and leaves contents intact.
+  TB_UNIT_EXPECT(!rb.push_back(8));
+  TB_UNIT_EXPECT_EQ(rb.size(), 8u);
+  TB_UNIT_EXPECT_EQ(rb.front(), 0);
+  TB_UNIT_EXPECT_EQ(rb[7], 7);
+}
+
+TB_UNIT_TEST(ring_buffer_wrap) {
+  tb::RingBuffer<int> rb(4);
+  int next_push = 0;
+  int next_pop = 0;
+  // Interleave pushes and pops such that pointers wrap many times.
+  for (int round = 0; round < 100; ++round) {
+    while (rb.push_back(next_push)) {
+      ++next_push;
+    }
+    for (std::size_t i = 0; i < rb.size(); ++i) {
+      TB_UNIT_EXPECT_EQ(rb[i], next_pop + static_cast<int>(i));
+    }
+    for (int i = 0; i < 3; ++i) {
+      TB_UNIT_EXPECT_EQ(rb.front(), next_pop++);
+      rb.pop_front();
+    }
+  }
+  rb.clear();
+  TB_UNIT_EXPECT(rb.empty());
+}
+
+TB_UNIT_TEST(ring_buffer_in_place) {
+  tb::RingBuffer<std::vector<int>> rb(2);
+  for (int round = 0; round < 4; ++round) {
+    TB_UNIT_EXPECT(!rb.full());
+    std::vector<int>& v = rb.back_slot();
+    v.assign(16, round);
+    TB_UNIT_EXPECT(rb.push_back());
+    TB_UNIT_EXPECT_EQ(rb.front().size(), 16u);
+    TB_UNIT_EXPECT_EQ(rb.front()[0], round);
+    rb.pop_front();
+  }
+  // Popped elements retain their storage for reuse.
+  TB_UNIT_EXPECT(rb.back_slot().capacity() >= 16u);
+
+  rb.back_slot().clear();
+  TB_UNIT_EXPECT(rb.push_back());
+  rb.back_slot().clear();
+  TB_UNIT_EXPECT(rb.push_back());
+  TB_UNIT_EXPECT(rb.full());
+  TB_UNIT_EXPECT(!rb.push_back());
+}
+
+TB_UNIT_TEST(log2_histogram_statistics) {
+  tb::axis::Log2Histogram h;
+  TB_UNIT_EXPECT_EQ(h.count(), 0u);
+  TB_UNIT_EXPECT_EQ(h.min(), 0u);
+  TB_UNIT_EXPECT_EQ(h.mean(), 0.0);
+
+  for (std::uint64_t v : {0, 1, 2, 3, 4, 1000}) {
+    h.sample(v);
+  }
+  TB_UNIT_EXPECT_EQ(h.count(), 6u);
+  TB_UNIT_EXPECT_EQ(h.min(), 0u);
+  TB_UNIT_EXPECT_EQ(h.max(), 1000u);
+  TB_UNIT_EXPECT_EQ(h.mean(), 1010.0 / 6);
+}
+
+TB_UNIT_TEST(log2_histogram_buckets) {
+  tb::axis::Log2Histogram h;
+  // Bucket k accumulates [2^(k-1), 2^k); 0 occupies bucket 0.
+  for (std::uint64_t v : {0, 1, 2, 3, 4, 7, 8}) {
+    h.sample(v);
+  }
+  std::ostringstream ss;
+  h.report(ss, "cycles");
+  const std::string s = ss.str();
+  TB_UNIT_EXPECT(s.find("[     0,      0]: 1") != std::string::npos);
+  TB_UNIT_EXPECT(s.find("[     1,      1]: 1") != std::string::npos);
+  TB_UNIT_EXPECT(s.find("[     2,      3]: 2") != std::string::npos);
+  TB_UNIT_EXPECT(s.find("[     4,      7]: 2") != std::string::npos);
+  TB_UNIT_EXPECT(s.find("[     8,     15]: 1") != std::string::npos);
+
+  // Values beyond the final bucket saturate into it.
+  tb::axis::Log2Histogram g;
+  g.sample(~std::uint64_t{0});
+  TB_UNIT_EXPECT_EQ(g.count(), 1u);
+}
+
+TB_UNIT_TEST(path_monitor_latency) {
+  Interface in, out;
+  tb::axis::PathMonitor pm("pm", in.ports(), out.ports());
+
+  // Single beat accepted at ingress, emitted at egress three cycles later.
+  in.ready = 1;
+  out.ready = 1;
+  for (std::size_t cycle = 0; cycle < 8; ++cycle) {
+    in.valid = (cycle == 1);
+    out.valid = (cycle == 4);
+    pm.sample();
+  }
+  TB_UNIT_EXPECT_EQ(pm.latency().count(), 1u);
+  TB_UNIT_EXPECT_EQ(pm.latency().min(), 3u);
+  pm.check();
+}
+
+TB_UNIT_TEST(path_monitor_pixel_throughput) {
+  Interface in, out;
+  tb::axis::PathMonitor pm("pm", in.ports(), out.ports(),
+    /*pixels_per_beat=*/4, /*window_n=*/16);
+
+  // One beat per cycle, of four pixels.
+  in.valid = in.ready = 1;
+  out.valid = out.ready = 1;
+  pm.expect_throughput(4.0);
+  for (std::size_t cycle = 0; cycle < 64; ++cycle) {
+    pm.sample();
+  }
+  TB_UNIT_EXPECT_EQ(pm.egress().beats_n(), 64u);
+  TB_UNIT_EXPECT_EQ(pm.egress().pixels_n(), 256u);
+  TB_UNIT_EXPECT_EQ(pm.egress().throughput(), 4.0);
+  TB_UNIT_EXPECT_EQ(pm.egress().window_min(), 4.0);
+  pm.check();
+
+  // Half rate, whilst input remains available, falls short of the
+  // assertion.
+  tb::axis::PathMonitor slow("slow", in.ports(), out.ports(), 4, 16);
+  slow.expect_throughput(4.0);
+  for (std::size_t cycle = 0; cycle < 64; ++cycle) {
+    out.valid = (cycle % 2) == 0;
+    slow.sample();
+  }
+  bool thrown = false;
+  try {
+    slow.check();
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  TB_UNIT_EXPECT(thrown);
+}
+
+TB_UNIT_TEST(path_monitor_stall_attribution) {
+  Interface in, out;
+  tb::axis::PathMonitor pm("pm", in.ports(), out.ports());
+
+  // Path of latency two; ingress bubbles at cycles [10, 12) appear at
+  // egress at cycles [12, 14), and are attributed upstream. Egress is
+  // back-pressured at cycles [20, 22), stalling a beat in each.
+  constexpr std::size_t LATENCY = 2;
+  auto in_valid = [](std::size_t cycle) {
+    return (cycle < 10) || ((cycle >= 12) && (cycle < 18));
+  };
+  in.ready = 1;
+  std::size_t emitted_n = 0, accepted_n = 0;
+  for (std::size_t cycle = 0; cycle < 30; ++cycle) {
+    in.valid = in_valid(cycle);
+    out.ready = (cycle < 20) || (cycle >= 22);
+    out.valid = (emitted_n < accepted_n) && (cycle >= LATENCY) &&
+                (in_valid(cycle - LATENCY) || (cycle >= 20));
+    pm.sample();
+    accepted_n += in.valid;
+    emitted_n += (out.valid && out.ready);
+  }
+  TB_UNIT_EXPECT_EQ(emitted_n, accepted_n);
+  TB_UNIT_EXPECT_EQ(pm.latency().min(), LATENCY);
+  TB_UNIT_EXPECT_EQ(pm.downstream_stall_n(), 2u);
+  // Cycles [12, 14) are upstream bubbles, as are cycles following the final
+  // beat; pipeline fill (cycles [0, 2)) precedes any latency measurement.
+  TB_UNIT_EXPECT_EQ(pm.dut_stall_n(), LATENCY);
+  pm.check();
+}
+
+TB_UNIT_TEST(scoreboard_in_order) {
+  using Scoreboard = tb::axis::Scoreboard<int>;
+  Scoreboard sb(2);
+  TB_UNIT_EXPECT(sb.observe(1) == Scoreboard::Result::Unexpected);
+
+  sb.push_back(1);
+  sb.push_back(2);
+  bool threw = false;
+  try {
+    sb.push_back(3);
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  TB_UNIT_EXPECT(threw);
+
+  // A mismatch is reported, and retires the oldest expectation.
+  std::vector<int> mismatches;
+  auto on_mismatch = [&](const int& e, const int&) {
+    mismatches.push_back(e);
+  };
+  TB_UNIT_EXPECT(sb.observe(2, std::equal_to<int>{}, on_mismatch) ==
+                 Scoreboard::Result::Mismatch);
+  TB_UNIT_EXPECT(mismatches == std::vector<int>{1});
+  TB_UNIT_EXPECT_EQ(sb.front(), 2);
+  TB_UNIT_EXPECT(sb.observe(2) == Scoreboard::Result::Match);
+  TB_UNIT_EXPECT(sb.empty());
+
+  TB_UNIT_EXPECT_EQ(sb.matched_n(), 1u);
+  TB_UNIT_EXPECT_EQ(sb.mismatched_n(), 1u);
+  TB_UNIT_EXPECT_EQ(sb.unexpected_n(), 1u);
+}
@@ -0,0 +1,210 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "tb/clock.h"
+#include "unit.h"
+
+namespace {
+
+using time_type = tb::ClockScheduler::time_type;
+
+// Edge of a clock; level is that following the edge (high on rising).
+struct Edge {
+  time_type t;
+  std::size_t clk;
+  bool level;
+
+  bool operator==(const Edge&) const = default;
+};
+
+struct ClockSpec {
+  time_type period;
+  time_type phase;
+};
+
+// Edges of all clocks up to (and including) time t_max, by enumeration
+// of each clock; ordered by time, then by clock index.
+std::vector<Edge> reference(
+  const std::vector<ClockSpec>& specs, time_type t_max) {
+  std::vector<Edge> edges;
+  for (std::size_t clk = 0; clk < specs.size(); ++clk) {
+    bool level = false;
+    for (time_type t = specs[clk].phase; t <= t_max;
+         t += specs[clk].period / 2) {
+      level = !level;
+      edges.push_back(Edge{t, clk, level});
+    }
+  }
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+    return std::tie(a.t, a.clk) < std::tie(b.t, b.clk);
+  });
+  return edges;
+}
+
+// Edges driven by the scheduler up to (and including) time t_max. The
+// number of edges reported by each advance must equal those driven.
+std::vector<Edge> schedule(
+  const std::vector<ClockSpec>& specs, time_type t_max) {
+  tb::ClockScheduler cs;
+  std::vector<Edge> edges;
+  for (std::size_t clk = 0; clk < specs.size(); ++clk) {
+    cs.add_clock("clk" + std::to_string(clk), specs[clk].period,
+      specs[clk].phase, [&cs, &edges, clk](bool v) {
+        edges.push_back(Edge{cs.now(), clk, v});
+      });
+  }
+  while (cs.next_time() <= t_max) {
+    const std::size_t driven_n = edges.size();
+    const std::size_t edges_n = cs.advance();
+    TB_UNIT_EXPECT_EQ(edges.size() - driven_n, edges_n);
+    TB_UNIT_EXPECT(edges_n != 0);
+  }
+  return edges;
+}
+
+void expect_schedule(const std::vector<ClockSpec>& specs, time_type t_max) {
+  const std::vector<Edge> expected = reference(specs, t_max);
+  const std::vector<Edge> actual = schedule(specs, t_max);
+  TB_UNIT_EXPECT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    TB_UNIT_EXPECT_EQ(actual[i].t, expected[i].t);
+    TB_UNIT_EXPECT_EQ(actual[i].clk, expected[i].clk);
+    TB_UNIT_EXPECT_EQ(actual[i].level, expected[i].level);
+  }
+}
+
+}  // namespace
+
+TB_UNIT_TEST(clock_single) {
+  // Primary clock as constructed by GenericSynchronousProjectInstance.
+  expect_schedule({{10, 5}}, 1000);
+}
+
+TB_UNIT_TEST(clock_period_and_phase) {
+  // Half-periods 5 and 3, with phases 5 and 2; the quantum (1) is finer
+  // than either clock.
+  expect_schedule({{10, 5}, {6, 2}}, 1000);
+
+  // Quantum of 2 (half-periods 10 and 6, phases 10 and 4).
+  expect_schedule({{20, 10}, {12, 4}}, 1000);
+}
+
+TB_UNIT_TEST(clock_coincident_edges) {
+  // Edges coincide at 6, 12, ...; driven in order of clock index, by a
+  // single advance.
+  tb::ClockScheduler cs;
+  std::vector<std::size_t> driven;
+  cs.add_clock("a", 6, 3, [&](bool) { driven.push_back(0); });
+  cs.add_clock("b", 4, 0, [&](bool) { driven.push_back(1); });
+
+  // b rises at time zero.
+  TB_UNIT_EXPECT_EQ(cs.advance(), 1u);
+  TB_UNIT_EXPECT_EQ(cs.now(), 0u);
+  TB_UNIT_EXPECT_EQ(cs.advance(), 1u);
+  TB_UNIT_EXPECT_EQ(cs.now(), 2u);
+  TB_UNIT_EXPECT_EQ(cs.advance(), 1u);
+  TB_UNIT_EXPECT_EQ(cs.now(), 3u);
+  TB_UNIT_EXPECT_EQ(cs.advance(), 1u);
+  TB_UNIT_EXPECT_EQ(cs.now(), 4u);
+
+  driven.clear();
+  TB_UNIT_EXPECT_EQ(cs.advance(), 2u);
+  TB_UNIT_EXPECT_EQ(cs.now(), 6u);
+  TB_UNIT_EXPECT_EQ(driven.size(), 2u);
+  TB_UNIT_EXPECT_EQ(driven[0], 0u);
+  TB_UNIT_EXPECT_EQ(driven[1], 1u);
+
+  expect_schedule({{6, 3}, {4, 0}}, 1000);
+}
+
+TB_UNIT_TEST(clock_wheel_wrap) {
+  // Half-period ratio and phase exceeding the minimum wheel size, such
+  // that pending edges wrap the wheel.
+  expect_schedule({{2, 1}, {1000, 777}, {14, 4}}, 5000);
+}
+
+TB_UNIT_TEST(clock_dispatch) {
+  // Callbacks are invoked on their nominated edge only, in order of clock
+  // index, after all coincident edges have been driven.
+  tb::ClockScheduler cs;
+  std::vector<std::tuple<time_type, char>> calls;
+  bool a_level = false;
+  bool b_level = false;
+  const std::size_t a =
+    cs.add_clock("a", 4, 2, [&](bool v) { a_level = v; });
+  const std::size_t b =
+    cs.add_clock("b", 8, 2, [&](bool v) { b_level = v; });
+  cs.on_edge(a, tb::ClockScheduler::Edge::Rising, [&]() {
+    TB_UNIT_EXPECT(a_level);
+    calls.emplace_back(cs.now(), 'a');
+  });
+  cs.on_edge(b, tb::ClockScheduler::Edge::Falling, [&]() {
+    TB_UNIT_EXPECT(!b_level);
+    calls.emplace_back(cs.now(), 'b');
+  });
+
+  // a: rising at 2, 6, 10; b: falling at 6.
+  bool dispatched = false;
+  while (cs.next_time() <= 10) {
+    cs.advance();
+    dispatched |= cs.dispatch();
+  }
+  TB_UNIT_EXPECT(dispatched);
+  const std::vector<std::tuple<time_type, char>> expected = {
+    {2, 'a'}, {6, 'a'}, {6, 'b'}, {10, 'a'}};
+  TB_UNIT_EXPECT(calls == expected);
+}
+
+TB_UNIT_TEST(clock_invalid) {
+  tb::ClockScheduler cs;
+  bool thrown = false;
+  try {
+    cs.add_clock("odd", 5, 0, [](bool) {});
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  TB_UNIT_EXPECT(thrown);
+
+  // Clocks may not be added once started.
+  cs.add_clock("clk", 10, 5, [](bool) {});
+  cs.advance();
+  thrown = false;
+  try {
+    cs.add_clock("late", 10, 5, [](bool) {});
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  TB_UNIT_EXPECT(thrown);
+}
@@ -0,0 +1,228 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "conv/conv_coverage.h"
+#include "tb/coverage.h"
+#include "unit.h"
+
+namespace {
+
+// Invocation of fn raises std::runtime_error.
+template <typename Fn>
+bool throws(Fn&& fn) {
+  try {
+    fn();
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+// Database file, removed on destruction.
+struct Database {
+  explicit Database(const std::string& fn) : fn(fn) {}
+  ~Database() { std::remove(fn.c_str()); }
+
+  void write(const std::string& content) const {
+    std::ofstream of{fn};
+    of << content;
+  }
+
+  std::string fn;
+};
+
+}  // namespace
+
+TB_UNIT_TEST(coverage_point_goal) {
+  tb::coverage::CoverageModel m;
+  tb::coverage::CoverPoint* p = m.add_point("p", 3, 2);
+  TB_UNIT_EXPECT(!m.goals_met());
+
+  for (std::size_t bin = 0; bin < 3; ++bin) {
+    p->sample(bin);
+  }
+  TB_UNIT_EXPECT_EQ(p->closed_n(), 0u);
+  for (std::size_t bin = 0; bin < 3; ++bin) {
+    p->sample(bin);
+    TB_UNIT_EXPECT(p->is_closed(bin));
+  }
+  TB_UNIT_EXPECT(m.goals_met());
+}
+
+TB_UNIT_TEST(coverage_merge) {
+  tb::coverage::CoverageModel a;
+  tb::coverage::CrossPoint* x = a.add_cross("x", 2, 2);
+  x->sample(0, 0);
+  x->sample(0, 1);
+
+  tb::coverage::CoverageModel b;
+  b.add_cross("x", 2, 2)->sample(1, 0);
+  b.add_point("p", 4)->sample(3);
+  b.lookup("x")->sample(3);
+
+  // Hits accumulate; absent points are created in the likeness of theirs.
+  a.merge(b);
+  TB_UNIT_EXPECT(a.lookup("x")->goals_met());
+  TB_UNIT_EXPECT(a.lookup("p") != nullptr);
+  TB_UNIT_EXPECT_EQ(a.lookup("p")->hits(3), 1u);
+  TB_UNIT_EXPECT(!a.goals_met());
+}
+
+TB_UNIT_TEST(coverage_merge_incompatible) {
+  tb::coverage::CoverageModel m;
+  m.add_cross("x", 2, 3);
+
+  // Kind: a plain point of as many bins as the cross.
+  tb::coverage::CoverageModel kind;
+  kind.add_point("x", 6);
+  TB_UNIT_EXPECT(throws([&] { m.merge(kind); }));
+
+  // Shape: a cross of as many bins, transposed.
+  tb::coverage::CoverageModel shape;
+  shape.add_cross("x", 3, 2);
+  TB_UNIT_EXPECT(throws([&] { m.merge(shape); }));
+
+  // Goal.
+  tb::coverage::CoverageModel goal;
+  goal.add_cross("x", 2, 3, 2);
+  TB_UNIT_EXPECT(throws([&] { m.merge(goal); }));
+}
+
+TB_UNIT_TEST(coverage_save_load) {
+  const Database db{"coverage_test_save_load.db"};
+
+  tb::coverage::CoverageModel a;
+  a.add_point("p", 3, 2)->sample(1);
+  a.add_cross("x", 2, 2)->sample(1, 1);
+  a.save(db.fn);
+
+  // Loading accumulates into the model, such that databases of parallel
+  // runs may be merged.
+  tb::coverage::CoverageModel b;
+  b.load(db.fn);
+  b.load(db.fn);
+  TB_UNIT_EXPECT_EQ(b.lookup("p")->hits(1), 2u);
+  TB_UNIT_EXPECT(b.lookup("p")->is_closed(1));
+  TB_UNIT_EXPECT_EQ(b.lookup("x")->hits(3), 2u);
+  TB_UNIT_EXPECT_EQ(b.lookup("x")->closed_n(), 1u);
+
+  // Into a model which already holds the point.
+  tb::coverage::CoverageModel c;
+  c.add_cross("x", 2, 2);
+  c.load(db.fn);
+  TB_UNIT_EXPECT_EQ(c.lookup("x")->hits(3), 1u);
+}
+
+TB_UNIT_TEST(coverage_load_incompatible) {
+  const Database db{"coverage_test_incompatible.db"};
+  tb::coverage::CoverageModel saved;
+  saved.add_cross("x", 2, 3);
+  saved.save(db.fn);
+
+  tb::coverage::CoverageModel kind;
+  kind.add_point("x", 6);
+  TB_UNIT_EXPECT(throws([&] { kind.load(db.fn); }));
+
+  tb::coverage::CoverageModel shape;
+  shape.add_cross("x", 3, 2);
+  TB_UNIT_EXPECT(throws([&] { shape.load(db.fn); }));
+
+  tb::coverage::CoverageModel goal;
+  goal.add_cross("x", 2, 3, 2);
+  TB_UNIT_EXPECT(throws([&] { goal.load(db.fn); }));
+}
+
+TB_UNIT_TEST(coverage_load_malformed) {
+  const Database db{"coverage_test_malformed.db"};
+  tb::coverage::CoverageModel m;
+
+  db.write("bin p 2 1\n0 0\n");
+  TB_UNIT_EXPECT(throws([&] { m.load(db.fn); }));
+
+  db.write("point p 3 1\n0 0\n");
+  TB_UNIT_EXPECT(throws([&] { m.load(db.fn); }));
+
+  TB_UNIT_EXPECT(throws([&] { m.load("coverage_test_absent.db"); }));
+}
+
+TB_UNIT_TEST(conv_coverage_closure) {
+  constexpr std::size_t N = 5;
+  constexpr std::size_t GROUPS_N = 4;
+  projects::conv::ConvCoverage<N> cov(/*has_lb_skid=*/true, GROUPS_N);
+  TB_UNIT_EXPECT(!cov.model().goals_met());
+
+  // Beats not presented are not sampled.
+  cov.sample_in(false, true, false, true);
+  TB_UNIT_EXPECT_EQ(
+    cov.model().lookup("sof_eol_backpressure")->closed_n(), 0u);
+
+  // Each class of presented beat, with and without backpressure.
+  for (const bool backpressure : {false, true}) {
+    cov.sample_in(true, true, false, backpressure);
+    cov.sample_in(true, false, false, backpressure);
+    cov.sample_in(true, false, true, backpressure);
+  }
+  TB_UNIT_EXPECT(cov.model().lookup("sof_eol_backpressure")->goals_met());
+
+  // Every border position is presented by a frame of N x N.
+  for (std::size_t y = 0; y < N; ++y) {
+    for (std::size_t x = 0; x < N; ++x) {
+      cov.sample_kernel(y, x, N, N);
+    }
+  }
+  TB_UNIT_EXPECT(cov.model().lookup("kernel_pos_border")->goals_met());
+
+  projects::conv::LbSkidState<N> s{};
+  for (std::size_t idx = 0; idx < GROUPS_N; ++idx) {
+    s.vld.fill(true);
+    s.idx.fill(idx);
+    cov.sample_lb_skid(s);
+  }
+  TB_UNIT_EXPECT(cov.model().goals_met());
+}
+
+TB_UNIT_TEST(conv_coverage_interior) {
+  // Positions away from the border of a large frame fall in the interior
+  // bin alone.
+  constexpr std::size_t N = 3;
+  projects::conv::ConvCoverage<N> cov(/*has_lb_skid=*/false, 1);
+  for (std::size_t y = 1; y < 31; ++y) {
+    cov.sample_kernel(y, 16, 32, 32);
+  }
+  const tb::coverage::CoverPoint* border =
+    cov.model().lookup("kernel_pos_border");
+  TB_UNIT_EXPECT_EQ(border->closed_n(), 1u);
+  TB_UNIT_EXPECT(border->is_closed(1 * N + 1));
+  TB_UNIT_EXPECT(cov.model().lookup("lb_skid_occupancy") == nullptr);
+}
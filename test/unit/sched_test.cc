@@ -0,0 +1,209 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tb/sched.h"
+#include "unit.h"
+
+namespace {
+
+using tb::sched::Event;
+using tb::sched::Scheduler;
+using tb::sched::Task;
+
+// Cycle at which a sequence passed a point of interest.
+using Log = std::vector<std::pair<std::string, std::size_t>>;
+
+// Invocation of fn raises std::runtime_error.
+template <typename Fn>
+bool throws(Fn&& fn) {
+  try {
+    fn();
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+// Run s to completion; returns the number of calls made to step.
+std::size_t run(Scheduler& s) {
+  std::size_t step_n = 0;
+  s.run([&step_n](std::size_t) { ++step_n; });
+  return step_n;
+}
+
+Task delays(Scheduler& s, Log& log, std::string name, std::size_t n) {
+  co_await s.negedge();
+  log.emplace_back(name, s.now());
+  co_await s.cycles(n);
+  log.emplace_back(name, s.now());
+  co_await s.cycles(0);
+  log.emplace_back(name, s.now());
+}
+
+Task until(Scheduler& s, Log& log, const bool& cond, std::size_t timeout_n) {
+  const bool satisfied = co_await s.until([&cond] { return cond; }, timeout_n);
+  log.emplace_back(satisfied ? "satisfied" : "timeout", s.now());
+}
+
+Task raise_at(Scheduler& s, bool& cond, std::size_t n) {
+  co_await s.cycles(n);
+  cond = true;
+}
+
+Task wait(Scheduler& s, Log& log, Event& e) {
+  co_await e;
+  log.emplace_back("notified", s.now());
+}
+
+Task notify_at(Scheduler& s, Event& e, std::size_t n) {
+  co_await s.cycles(n);
+  e.notify();
+}
+
+Task fail_at(Scheduler& s, std::size_t n) {
+  co_await s.cycles(n);
+  throw std::runtime_error("Nested failure");
+}
+
+Task catch_nested(Scheduler& s, Log& log) {
+  try {
+    co_await fail_at(s, 2);
+  } catch (const std::runtime_error&) {
+    log.emplace_back("caught", s.now());
+  }
+}
+
+Task propagate_nested(Scheduler& s, Log& log) {
+  co_await fail_at(s, 3);
+  log.emplace_back("unreachable", s.now());
+}
+
+}  // namespace
+
+TB_UNIT_TEST(sched_cycles_order) {
+  Scheduler s;
+  Log log;
+  s.spawn(delays(s, log, "a", 3));
+  s.spawn(delays(s, log, "b", 2));
+  s.spawn(delays(s, log, "c", 2));
+  run(s);
+
+  // Sequences due in the same cycle resume in order of suspension; zero
+  // cycles do not suspend.
+  const Log expected{{"a", 1}, {"b", 1}, {"c", 1}, {"b", 3}, {"b", 3},
+                     {"c", 3}, {"c", 3}, {"a", 4}, {"a", 4}};
+  TB_UNIT_EXPECT(log == expected);
+  TB_UNIT_EXPECT_EQ(s.now(), 4u);
+  TB_UNIT_EXPECT(s.done());
+}
+
+TB_UNIT_TEST(sched_quiescent_step) {
+  Scheduler s;
+  Log log;
+  s.spawn(delays(s, log, "a", 1000));
+
+  // Beyond the first negedge, the wait is stepped at once.
+  TB_UNIT_EXPECT_EQ(run(s), 2u);
+  TB_UNIT_EXPECT_EQ(s.now(), 1001u);
+}
+
+TB_UNIT_TEST(sched_until_timeout) {
+  Scheduler s;
+  Log log;
+  bool never = false;
+  bool raised = false;
+  s.spawn(until(s, log, never, 5));
+  s.spawn(until(s, log, raised, 10));
+  s.spawn(raise_at(s, raised, 3));
+  run(s);
+
+  // Conditions are polled at the start of the cycle following the one in
+  // which they were raised.
+  const Log expected{{"satisfied", 4}, {"timeout", 5}};
+  TB_UNIT_EXPECT(log == expected);
+}
+
+TB_UNIT_TEST(sched_event_in_step) {
+  Scheduler s;
+  Event e{s};
+  Log log;
+  s.spawn(wait(s, log, e));
+  s.spawn(wait(s, log, e));
+  s.spawn(notify_at(s, e, 3));
+  run(s);
+
+  // Waiters resume within the notifying step.
+  const Log expected{{"notified", 3}, {"notified", 3}};
+  TB_UNIT_EXPECT(log == expected);
+}
+
+TB_UNIT_TEST(sched_event_outside_step) {
+  Scheduler s;
+  Event e{s};
+  Log log;
+  s.spawn(wait(s, log, e));
+  s.advance(0);
+  TB_UNIT_EXPECT(!s.done());
+
+  // Waiters resume within the next step.
+  e.notify();
+  TB_UNIT_EXPECT(log.empty());
+  s.advance(1);
+  const Log expected{{"notified", 1}};
+  TB_UNIT_EXPECT(log == expected);
+  TB_UNIT_EXPECT(s.done());
+}
+
+TB_UNIT_TEST(sched_nested_exception) {
+  Scheduler s;
+  Log log;
+  s.spawn(catch_nested(s, log));
+  run(s);
+  const Log caught{{"caught", 2}};
+  TB_UNIT_EXPECT(log == caught);
+
+  // Uncaught, the exception propagates through the awaiter to run.
+  s.spawn(propagate_nested(s, log));
+  TB_UNIT_EXPECT(throws([&s] { run(s); }));
+  TB_UNIT_EXPECT(log == caught);
+  TB_UNIT_EXPECT(s.done());
+}
+
+TB_UNIT_TEST(sched_deadlock) {
+  Scheduler s;
+  Event e{s};
+  Log log;
+  s.spawn(wait(s, log, e));
+  TB_UNIT_EXPECT(throws([&s] { run(s); }));
+  TB_UNIT_EXPECT(log.empty());
+}
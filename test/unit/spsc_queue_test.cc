@@ -0,0 +1,162 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+#include "tb/spsc_queue.h"
+#include "unit.h"
+
+namespace {
+
+// Time for which a thread is left to (potentially) block.
+constexpr auto SETTLE = std::chrono::milliseconds(50);
+
+}  // namespace
+
+TB_UNIT_TEST(spsc_queue_order) {
+  tb::SpscQueue<std::size_t> q{5};
+  TB_UNIT_EXPECT_EQ(q.capacity(), 8u);
+
+  std::size_t t = 0;
+  TB_UNIT_EXPECT(!q.try_pop(t));
+  for (std::size_t i = 0; i < 5; ++i) {
+    q.push(i);
+  }
+  for (std::size_t i = 0; i < 5; ++i) {
+    TB_UNIT_EXPECT(q.try_pop(t));
+    TB_UNIT_EXPECT_EQ(t, i);
+  }
+  TB_UNIT_EXPECT(!q.try_pop(t));
+}
+
+TB_UNIT_TEST(spsc_queue_wrap) {
+  tb::SpscQueue<std::size_t> q{4};
+
+  // Fill to capacity; a rejected entry is left intact.
+  std::size_t wr = 0;
+  for (; wr < q.capacity(); ++wr) {
+    std::size_t t = wr;
+    TB_UNIT_EXPECT(q.try_push(t));
+  }
+  std::size_t t = wr;
+  TB_UNIT_EXPECT(!q.try_push(t));
+  TB_UNIT_EXPECT_EQ(t, wr);
+
+  // Drain and refill in halves, such that the indices wrap the storage
+  // several times over.
+  std::size_t rd = 0;
+  for (std::size_t round = 0; round < 16; ++round) {
+    for (std::size_t i = 0; i < q.capacity() / 2; ++i) {
+      TB_UNIT_EXPECT(q.try_pop(t));
+      TB_UNIT_EXPECT_EQ(t, rd++);
+    }
+    for (std::size_t i = 0; i < q.capacity() / 2; ++i) {
+      t = wr++;
+      TB_UNIT_EXPECT(q.try_push(t));
+    }
+    TB_UNIT_EXPECT(!q.try_push(t));
+  }
+  while (q.try_pop(t)) {
+    TB_UNIT_EXPECT_EQ(t, rd++);
+  }
+  TB_UNIT_EXPECT_EQ(rd, wr);
+}
+
+TB_UNIT_TEST(spsc_queue_blocking_pop) {
+  tb::SpscQueue<std::size_t> q{4};
+
+  // Consumer exhausts its spin and sleeps before the producer pushes.
+  std::atomic<bool> popped{false};
+  std::size_t t = 0;
+  std::thread consumer{[&] {
+    q.pop(t);
+    popped.store(true);
+  }};
+  std::this_thread::sleep_for(SETTLE);
+  TB_UNIT_EXPECT(!popped.load());
+
+  q.push(42);
+  consumer.join();
+  TB_UNIT_EXPECT(popped.load());
+  TB_UNIT_EXPECT_EQ(t, 42u);
+}
+
+TB_UNIT_TEST(spsc_queue_full_backoff) {
+  tb::SpscQueue<std::size_t> q{4};
+  for (std::size_t i = 0; i < q.capacity(); ++i) {
+    q.push(i);
+  }
+
+  // Producer backs off on the full queue until an entry is popped.
+  std::atomic<bool> pushed{false};
+  std::thread producer{[&] {
+    q.push(q.capacity());
+    pushed.store(true);
+  }};
+  std::this_thread::sleep_for(SETTLE);
+  TB_UNIT_EXPECT(!pushed.load());
+
+  std::size_t t = 0;
+  q.pop(t);
+  TB_UNIT_EXPECT_EQ(t, 0u);
+  producer.join();
+  TB_UNIT_EXPECT(pushed.load());
+  for (std::size_t i = 1; i <= q.capacity(); ++i) {
+    q.pop(t);
+    TB_UNIT_EXPECT_EQ(t, i);
+  }
+}
+
+TB_UNIT_TEST(spsc_queue_stream) {
+  constexpr std::size_t N = 100000;
+  tb::SpscQueue<std::size_t> q{16};
+
+  // Producer and consumer run concurrently, alternately starving and
+  // filling the queue; entries arrive complete and in order.
+  std::thread producer{[&] {
+    for (std::size_t i = 0; i < N; ++i) {
+      q.push(i);
+      if ((i % 4096) == 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    }
+  }};
+  std::size_t mismatch_n = 0;
+  for (std::size_t i = 0; i < N; ++i) {
+    std::size_t t = 0;
+    q.pop(t);
+    mismatch_n += (t != i);
+    if ((i % 8192) == 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  }
+  producer.join();
+  TB_UNIT_EXPECT_EQ(mismatch_n, 0u);
+}
@@ -0,0 +1,69 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "unit.h"
+
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+namespace tb::unit {
+
+namespace {
+
+struct Failure : std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+}  // namespace
+
+std::vector<TestCase>& registry() {
+  static std::vector<TestCase> tests;
+  return tests;
+}
+
+void fail(const char* file, int line, const std::string& msg) {
+  throw Failure(std::string{file} + ":" + std::to_string(line) + ": " + msg);
+}
+
+}  // namespace tb::unit
+
+int main() {
+  std::size_t failed_n = 0;
+  for (const tb::unit::TestCase& tc : tb::unit::registry()) {
+    try {
+      tc.fn();
+      std::cout << "[PASS] " << tc.name << "\n";
+    } catch (const std::exception& ex) {
+      std::cout << "[FAIL] " << tc.name << ": " << ex.what() << "\n";
+      ++failed_n;
+    }
+  }
+  std::cout << (tb::unit::registry().size() - failed_n) << "/"
+            << tb::unit::registry().size() << " tests passed\n";
+  return (failed_n == 0) ? 0 : 1;
+}
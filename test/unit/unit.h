@@ -0,0 +1,86 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TEST_UNIT_UNIT_H
+#define TEST_UNIT_UNIT_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Minimal unit test harness for the testbench library. Tests are registered
+// at static initialization by TB_UNIT_TEST and run, in order of
+// registration, by the unit executable; a failed expectation aborts the
+// current test, which is reported as failed.
+
+namespace tb::unit {
+
+struct TestCase {
+  const char* name;
+  void (*fn)();
+};
+
+// Tests registered to date.
+std::vector<TestCase>& registry();
+
+struct Registrar {
+  explicit Registrar(const char* name, void (*fn)()) {
+    registry().push_back(TestCase{name, fn});
+  }
+};
+
+// Raise failure of the current test.
+[[noreturn]] void fail(const char* file, int line, const std::string& msg);
+
+}  // namespace tb::unit
+
+#define TB_UNIT_TEST(__name)                                              \
+  static void tb_unit_test_##__name();                                    \
+  static const ::tb::unit::Registrar tb_unit_registrar_##__name{          \
+    #__name, &tb_unit_test_##__name};                                     \
+  static void tb_unit_test_##__name()
+
+#define TB_UNIT_EXPECT(__cond)                                            \
+  do {                                                                    \
+    if (!(__cond)) {                                                      \
+      ::tb::unit::fail(__FILE__, __LINE__, #__cond);                      \
+    }                                                                     \
+  } while (0)
+
+#define TB_UNIT_EXPECT_EQ(__lhs, __rhs)                                   \
+  do {                                                                    \
+    const auto& tb_unit_lhs = (__lhs);                                    \
+    const auto& tb_unit_rhs = (__rhs);                                    \
+    if (!(tb_unit_lhs == tb_unit_rhs)) {                                  \
+      std::ostringstream tb_unit_ss;                                      \
+      tb_unit_ss << #__lhs << " == " << #__rhs << " (" << tb_unit_lhs     \
+                 << " vs. " << tb_unit_rhs << ")";                        \
+      ::tb::unit::fail(__FILE__, __LINE__, tb_unit_ss.str());             \
+    }                                                                     \
+  } while (0)
+
+#endif  // TEST_UNIT_UNIT_H